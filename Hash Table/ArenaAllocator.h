@@ -0,0 +1,82 @@
+/*
+This file implements a bump/arena allocator for short-lived HashTable instances. An Arena owns
+one preallocated region; ArenaAllocator<T> carves allocations out of it by bumping an offset,
+and individual deallocations are no-ops. Freeing everything the arena handed out is O(1): reset
+the arena (or let it go out of scope). Thousands of per-request tables can share one arena per
+request instead of hitting the global allocator for every table they build.
+*/
+
+#ifndef ARENA_ALLOCATOR_H // Include guard to prevent duplicate definitions
+#define ARENA_ALLOCATOR_H // This line defines the header file if it has not been defined before
+
+#include <cstddef> // Include cstddef for size_t and max_align_t
+#include <memory> // Include memory for the fallback allocator
+#include <new> // Include new for bad_alloc
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the arena itself: one region and a bump offset.
+class Arena { // Arena class definition
+private: // Private section for internal data
+	unique_ptr<unsigned char[]> region; // The preallocated region all allocations are carved from
+	size_t regionSize; // Total bytes in the region
+	size_t offset; // Bytes handed out so far; allocation just advances this
+
+public: // Public section for external interface methods
+	explicit Arena(size_t bytes) : region(new unsigned char[bytes]), regionSize(bytes), offset(0) {} // Constructor preallocating the region
+
+	Arena(const Arena&) = delete; // Arenas are not copyable: allocators hold pointers into them
+	Arena& operator=(const Arena&) = delete; // Arenas are not assignable for the same reason
+
+	void* allocate(size_t bytes, size_t alignment) { // Carve an aligned block out of the region
+		size_t aligned = (offset + alignment - 1) & ~(alignment - 1); // Bump the offset up to the requested alignment
+		if (aligned + bytes > regionSize) { // If the region cannot hold the block
+			throw bad_alloc(); // The arena was sized too small for this workload
+        }
+		offset = aligned + bytes; // Advance past the block
+		return region.get() + aligned; // Return the carved block
+    }
+
+	void reset() { // Free everything the arena handed out, in O(1)
+		offset = 0; // All outstanding blocks are invalidated at once
+    }
+
+	size_t used() const { return offset; } // Getter method for the bytes handed out so far
+	size_t capacity() const { return regionSize; } // Getter method for the region size
+};
+
+// This section defines the allocator handle that HashTable's Allocator parameter accepts. All
+// rebound copies of one ArenaAllocator share the same Arena, so the table's four slot arrays
+// are carved from one region.
+template <typename T> // Element type this handle allocates
+class ArenaAllocator { // ArenaAllocator class definition
+private: // Private section for internal data
+	Arena* arena; // The shared arena allocations are carved from, never null
+
+	template <typename U> // Other element types' handles
+	friend class ArenaAllocator; // Rebound copies need to see each other's arena pointer
+
+public: // Public section for the allocator interface
+	using value_type = T; // Element type, as the allocator protocol requires
+
+	explicit ArenaAllocator(Arena& a) : arena(&a) {} // Constructor binding the handle to an arena
+
+	template <typename U> // Element type of the handle being copied
+	ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {} // Rebinding copy shares the same arena
+
+	T* allocate(size_t n) { // Allocate storage for n elements
+		return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T))); // Carve the block from the arena
+    }
+
+	void deallocate(T*, size_t) { // Deallocation is a no-op
+		// The memory is reclaimed all at once when the arena is reset or destroyed
+    }
+
+	template <typename U> // Element type of the handle being compared
+	bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; } // Handles are equal when they share an arena
+
+	template <typename U> // Element type of the handle being compared
+	bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; } // Inequality is the negation
+};
+
+#endif // End of include guard for ARENA_ALLOCATOR_H
@@ -0,0 +1,132 @@
+/*
+This file implements a templated ConcurrentHashTable class for multi-core workloads. It shards
+keys across a power-of-two number of independent HashTable sub-tables, each guarded by its own
+reader-writer lock (striped locking), so writers on different shards never contend and readers
+on the same shard proceed in parallel. The class exposes the same insert/retrieve/remove style
+of interface as HashTable itself.
+*/
+
+#ifndef CONCURRENT_HASH_TABLE_H // Include guard to prevent duplicate definitions
+#define CONCURRENT_HASH_TABLE_H // This line defines the header file if it has not been defined before
+
+#include <shared_mutex> // Include shared_mutex for per-shard reader-writer locks
+#include <mutex> // Include mutex for the lock guards
+#include <vector> // Include vector for the shard array
+#include <optional> // Include optional for non-throwing retrieval
+#include <stdexcept> // Include stdexcept for runtime_error
+#include "HashTable.h" // Include the single-threaded table each shard is built on
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the sharded table: each shard pairs a HashTable with its own lock.
+template <typename K, typename V, typename Hasher = hash<K>> // Template for key, value, and hash policy types
+class ConcurrentHashTable { // ConcurrentHashTable class definition
+private: // Private section for internal data and helper methods
+	static const int DEFAULT_SHARDS = 16; // Default number of shards, sized for current core counts
+
+	struct Shard { // One independent sub-table with its own lock
+		mutable shared_mutex lock; // Reader-writer lock: shared for lookups, exclusive for mutations
+		HashTable<K, V, Hasher> table; // The shard's underlying single-threaded table
+    };
+
+	vector<Shard> shards; // The shard array, fixed at construction and never reallocated
+	int shardMask; // Bitmask selecting a shard from the mixed hash, shard count minus one
+	Hasher hasher; // The table's hash policy instance, default-constructed
+
+	Shard& shardFor(const K& key) { // Pick the shard owning a key
+		unsigned long long m = static_cast<unsigned long long>(hasher(key)) * 0x9E3779B97F4A7C15ULL; // Mix in 64 bits so weak hashers still spread across shards, even where size_t is 32 bits
+		return shards[static_cast<size_t>(m >> 32) & static_cast<size_t>(shardMask)]; // Select by high bits, disjoint from the in-shard index bits
+    }
+
+	const Shard& shardFor(const K& key) const { // Const overload of the shard selector
+		unsigned long long m = static_cast<unsigned long long>(hasher(key)) * 0x9E3779B97F4A7C15ULL; // Mix in 64 bits so weak hashers still spread across shards, even where size_t is 32 bits
+		return shards[static_cast<size_t>(m >> 32) & static_cast<size_t>(shardMask)]; // Select by high bits, disjoint from the in-shard index bits
+    }
+
+	static int roundUpToPowerOfTwo(int s) { // Round a requested shard count up to the next power of two
+		int p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested count
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+// This section defines the public interface, mirroring HashTable's own.
+public: // Public section for external interface methods
+	ConcurrentHashTable(int shardCount = DEFAULT_SHARDS) // Constructor taking the number of shards
+		: shards(roundUpToPowerOfTwo(shardCount < 1 ? 1 : shardCount)), // Build the shard array at a power-of-two size
+		shardMask(static_cast<int>(shards.size()) - 1) { // Cache the selection mask
+    }
+
+	void insert(const K& key, const V& value) { // Insert a key-value pair by copy
+		Shard& s = shardFor(key); // Locate the owning shard
+		unique_lock<shared_mutex> guard(s.lock); // Writers take the shard lock exclusively
+		s.table.insert(key, value); // Delegate to the shard's table
+    }
+
+	void insert(K&& key, V&& value) { // Insert a key-value pair by move
+		Shard& s = shardFor(key); // Locate the owning shard before the key is moved
+		unique_lock<shared_mutex> guard(s.lock); // Writers take the shard lock exclusively
+		s.table.insert(move(key), move(value)); // Delegate to the shard's table
+    }
+
+	// Lookups return the value by copy rather than by pointer: a pointer into a shard would
+	// dangle as soon as the lock is released and another thread's insert resizes that shard.
+	optional<V> tryRetrieve(const K& key) const { // Retrieve a value without throwing
+		const Shard& s = shardFor(key); // Locate the owning shard
+		shared_lock<shared_mutex> guard(s.lock); // Readers share the shard lock, so hits never serialize each other
+		const V* value = s.table.find(key); // Probe the shard's table
+		if (value == nullptr) { // If key was not found
+			return nullopt; // Signal the miss without an exception
+        }
+		return *value; // Copy the value out while the lock is held
+    }
+
+	V retrieve(const K& key) const { // Retrieve a value, throwing if not found
+		optional<V> value = tryRetrieve(key); // Probe without throwing
+		if (!value.has_value()) { // If key was not found
+			throw runtime_error("Key not found"); // Throw exception if key is not found
+        }
+		return move(*value); // Return the copied value
+    }
+
+	bool contains(const K& key) const { // Whether a key is present
+		const Shard& s = shardFor(key); // Locate the owning shard
+		shared_lock<shared_mutex> guard(s.lock); // Readers share the shard lock
+		return s.table.find(key) != nullptr; // Probe the shard's table
+    }
+
+	void remove(const K& key) { // Remove a key-value pair
+		Shard& s = shardFor(key); // Locate the owning shard
+		unique_lock<shared_mutex> guard(s.lock); // Writers take the shard lock exclusively
+		s.table.remove(key); // Delegate to the shard's table
+    }
+
+	size_t getCount() const { // Total element count across all shards
+		size_t total = 0; // Accumulated count
+		for (const Shard& s : shards) { // Visit every shard
+			shared_lock<shared_mutex> guard(s.lock); // Readers share each shard lock in turn
+			total += s.table.getCount(); // Add the shard's count
+        }
+		return total; // Counts are per-shard snapshots, not one global atomic snapshot
+    }
+
+	int getShardCount() const { return static_cast<int>(shards.size()); } // Getter method for the shard count
+
+	void reserve(size_t n) { // Size every shard once for n total elements
+		size_t perShard = n / shards.size() + 1; // Spread the capacity across shards
+		for (Shard& s : shards) { // Visit every shard
+			unique_lock<shared_mutex> guard(s.lock); // Writers take each shard lock exclusively
+			s.table.reserve(perShard); // Delegate to the shard's table
+        }
+    }
+
+	void clear() { // Clear every shard
+		for (Shard& s : shards) { // Visit every shard
+			unique_lock<shared_mutex> guard(s.lock); // Writers take each shard lock exclusively
+			s.table.clear(); // Delegate to the shard's table
+        }
+    }
+};
+
+#endif // End of include guard for CONCURRENT_HASH_TABLE_H
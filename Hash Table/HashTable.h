@@ -1,9 +1,9 @@
-/* 
-This file implements a templated HashTable class using double hashing for collision resolution.
-It includes methods for inserting, retrieving, and removing key-value pairs, as well as dynamic
-resizing to maintain performance. The implementation uses open addressing and handles collisions
-through a custom double hashing function, with additional utility methods for debugging and
-performance analysis.
+/*
+This file implements a templated HashTable class using open addressing with Swiss-table style
+group probing for collision resolution. It includes methods for inserting, retrieving, and
+removing key-value pairs, as well as dynamic resizing to maintain performance. Slots are probed
+a metadata group (16 or 32 bytes) at a time using SIMD compares where the target supports them,
+with additional utility methods for debugging and performance analysis.
 */
 
 #ifndef HASH_TABLE_H // Include guard to prevent duplicate definitions
@@ -12,154 +12,1480 @@ performance analysis.
 #include <vector> // Include vector for dynamic array storage
 #include <stdexcept> // Include stdexcept for runtime_error
 #include <functional> // Include functional for hash
-#include <iostream> // Include iostream for console output
+#include <utility> // Include utility for move, forward, and pair
+#include <optional> // Include optional for non-throwing retrieval
+#include <string> // Include string so string-keyed tables get transparent hashing
+#include <string_view> // Include string_view for heterogeneous lookup of string keys
+#include <type_traits> // Include type_traits for the transparent-hash dispatch
+#include <memory> // Include memory for allocator_traits and the Allocator template parameter
+#include <algorithm> // Include algorithm for fill in the inline-storage paths
+#include <ostream> // Include ostream for the print() debugging helper; the data path does no stream I/O
+#include <istream> // Include istream for deserialize()
+#include <thread> // Include thread for the parallel bulk-load and rehash workers
+#include <iterator> // Include iterator for distance and advance over bulk-load input ranges
+
+// Compile-time selection of the widest metadata-scanning kernel the target supports. The probe
+// loops compare one metadata group per step; the group is 32 bytes with AVX2, 16 bytes with
+// SSE2 or NEON, and 16 bytes scanned a byte at a time on targets with none of them.
+#if defined(__AVX2__) // AVX2 available (e.g. /arch:AVX2 or -mavx2)
+#include <immintrin.h> // Include AVX2 intrinsics
+#define HASH_TABLE_SIMD_AVX2 1 // Select the 32-byte AVX2 kernel
+#define HASH_TABLE_GROUP_SIZE 32 // Metadata group size in bytes
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) // SSE2 available (implied on x64)
+#include <emmintrin.h> // Include SSE2 intrinsics
+#define HASH_TABLE_SIMD_SSE2 1 // Select the 16-byte SSE2 kernel
+#define HASH_TABLE_GROUP_SIZE 16 // Metadata group size in bytes
+#elif defined(__aarch64__) && defined(__ARM_NEON) // NEON available on 64-bit ARM
+#include <arm_neon.h> // Include NEON intrinsics
+#define HASH_TABLE_SIMD_NEON 1 // Select the 16-byte NEON kernel
+#define HASH_TABLE_GROUP_SIZE 16 // Metadata group size in bytes
+#else // No vector unit detected
+#define HASH_TABLE_GROUP_SIZE 16 // Scalar fallback still probes 16-byte groups for identical semantics
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__) // MSVC needs its intrinsic for bit scanning
+#include <intrin.h> // Include _BitScanForward
+#endif
 
 using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
 
+// Define HASH_TABLE_EVENTS to compile in the statistics/event surface: per-table counters for
+// resizes and failed inserts plus optional raw-function-pointer callbacks fired on those events.
+// When the macro is not defined none of it exists, so the data path pays nothing for it. This
+// replaces the old cout logging in insert()/resize(), which serialized multi-threaded loaders
+// on the console lock.
+
+// Define HASH_TABLE_STATS to compile in the probe instrumentation: a per-operation probe-length
+// histogram (in metadata groups), the mean and maximum probe length, resize counts, and the
+// tombstone ratio, all snapshotted through getStats(). Probe recording sits inside the hot
+// loops, so it is a separate opt-in from HASH_TABLE_EVENTS and costs nothing when off.
+
+// This section defines the hash policies shipped with the table. The Hasher template parameter
+// defaults to std::hash<K>, but std::hash is the identity function for integers on the major
+// standard libraries, which clusters badly on sequential-ID workloads once the table masks the
+// hash down to an index. These policies can be swapped in per deployment without forking the
+// header.
+
+// Mixing hash for integer keys: the splitmix64 finalizer (a fibonacci/xxhash-style multiply and
+// xor-shift chain) spreads sequential inputs across the whole hash range. Transparent, so any
+// integral type can probe a table keyed on any other.
+struct IntegerMixHash { // Integer mixing hash policy
+	using is_transparent = void; // Accepts any integral lookup key
+	template <typename T> // Any integral key type
+	size_t operator()(T key) const { // Mix the key's bits
+		static_assert(is_integral<T>::value, "IntegerMixHash only hashes integral keys"); // Reject non-integer keys at compile time
+		unsigned long long x = static_cast<unsigned long long>(key); // Widen to 64 bits
+		x ^= x >> 30; // First xor-shift
+		x *= 0xBF58476D1CE4E5B9ULL; // First multiply
+		x ^= x >> 27; // Second xor-shift
+		x *= 0x94D049BB133111EBULL; // Second multiply
+		x ^= x >> 31; // Final xor-shift
+		return static_cast<size_t>(x); // Return the mixed hash
+    }
+};
+
+// Fast bytewise hash for string keys: 64-bit FNV-1a over the characters. Transparent, so
+// string, string_view, and const char* probes all hash identically with no allocation.
+struct FastStringHash { // Bytewise string hash policy
+	using is_transparent = void; // Accepts any string-like lookup key
+	size_t operator()(string_view key) const { // Hash the characters
+		unsigned long long h = 0xCBF29CE484222325ULL; // FNV-1a offset basis
+		for (char c : key) { // Walk the bytes
+			h ^= static_cast<unsigned char>(c); // Fold in the byte
+			h *= 0x00000100000001B3ULL; // FNV-1a prime
+        }
+		return static_cast<size_t>(h); // Return the folded hash
+    }
+};
+
 //This section initializes the hash table with a given size or default size.
-template <typename K, typename V> // Template for key-value pair types
+template <typename K, typename V, typename Hasher = hash<K>, typename Allocator = allocator<unsigned char>> // Template for key, value, hash policy, and allocator types
 class HashTable { // HashTable class definition
 private: // Private section for internal data and helper methods
-	static const int DEFAULT_SIZE = 10; // Default size for the hash table
-	vector<pair<K, V>> table; // Vector to store key-value pairs
-	vector<bool> occupied; // Vector to track occupied slots
-	int size; // Current size of the hash table
-	int count; // Number of elements in the hash table
+	static constexpr size_t DEFAULT_SIZE = 16; // Default size for the hash table, always a power of two
+	static constexpr size_t NPOS = static_cast<size_t>(-1); // "No slot" sentinel for unsigned slot indices
+
+	// Each slot has a one-byte metadata entry, Swiss-table style. The high bit distinguishes the
+	// two sentinel states from occupied slots; an occupied slot stores a 7-bit fragment of the
+	// key's hash, so a probe can reject almost every mismatched slot by scanning the dense byte
+	// array alone, without ever touching the key or value storage.
+	static constexpr unsigned char META_EMPTY = 0x80; // Slot has never held an element, probes stop here
+	static constexpr unsigned char META_DELETED = 0xFE; // Tombstone: element removed, probes must continue past it
+	static constexpr unsigned char META_CLAIMED = 0xFD; // Slot claimed by a parallel bulk-load worker but not yet published; never present outside bulkLoad/rehashParallel
+
+	// The Allocator template parameter is rebound for each slot array, so one allocator type
+	// (and instance) serves all four. Short-lived per-request tables can pass an arena/bump
+	// allocator (see ArenaAllocator.h) and be carved from a preallocated region.
+	using MetaAllocator = typename allocator_traits<Allocator>::template rebind_alloc<unsigned char>; // Allocator for the metadata bytes
+	using KeyAllocator = typename allocator_traits<Allocator>::template rebind_alloc<K>; // Allocator for the key array
+	using ValueAllocator = typename allocator_traits<Allocator>::template rebind_alloc<V>; // Allocator for the value array
+	using HashAllocator = typename allocator_traits<Allocator>::template rebind_alloc<size_t>; // Allocator for the hash cache
+
+	Allocator alloc; // The allocator instance every slot array is rebound from
+	// Sizes, counts, and slot indices are size_t throughout: int indexing overflows past 2^31
+	// slots, and billion-entry tables are a supported shape. Doubling a size_t size cannot
+	// overflow before memory does.
+	size_t size; // Current size of the hash table, always a power of two; declared before the arrays so they can be sized from it
+	size_t count; // Number of elements in the hash table
+	size_t tombstones; // Number of tombstoned (deleted) slots awaiting reclamation
+	double maxLoadFactor; // Load-factor threshold (counting tombstones) that triggers a resize
+
+	vector<unsigned char, MetaAllocator> meta; // One metadata byte per slot: sentinel or 7-bit hash fragment
+	vector<K, KeyAllocator> keys; // Keys stored separately so probe misses never drag values through cache
+	vector<V, ValueAllocator> values; // Values stored separately, touched only on a confirmed hit
+	vector<size_t, HashAllocator> hashes; // Cached full hash value per slot, so probes and resize never re-hash keys
+
+	// Small-buffer storage: a table that fits in one metadata group keeps its slot arrays inside
+	// the object itself, so constructing a default-sized table performs no heap allocation at
+	// all. Per-request code that builds thousands of tiny tables never touches the allocator
+	// until a table actually outgrows the group. The buffers exist only when the per-slot
+	// footprint keeps the inline block modest; larger K/V shapes always use the heap arrays.
+	static constexpr bool INLINE_CAPABLE = (1 + sizeof(K) + sizeof(V) + sizeof(size_t)) * HASH_TABLE_GROUP_SIZE <= 1024; // Whether one group of slots fits in a reasonable in-object block
+	static constexpr size_t INLINE_SLOTS = INLINE_CAPABLE ? HASH_TABLE_GROUP_SIZE : 1; // Inline capacity, collapsed to one slot when inlining is off
 
-	int hash1(const K& key) const { // First hash function using modulo
-		return hash<K>{}(key) % size; // Hash the key and take modulo of size
+	bool inlineStorage; // Whether the slot arrays currently live in the object instead of the vectors
+	unsigned char inlineMeta[INLINE_SLOTS]; // In-object metadata bytes for the small-table case
+	K inlineKeys[INLINE_SLOTS]; // In-object key storage for the small-table case
+	V inlineValues[INLINE_SLOTS]; // In-object value storage for the small-table case
+	size_t inlineHashes[INLINE_SLOTS]; // In-object hash cache for the small-table case
+
+	// Every probe and traversal reaches storage through these accessors, so the inline and heap
+	// cases share all of the surrounding code.
+	unsigned char* metaData() { return inlineStorage ? inlineMeta : meta.data(); } // Active metadata array
+	const unsigned char* metaData() const { return inlineStorage ? inlineMeta : meta.data(); } // Const overload
+	K* keysData() { return inlineStorage ? inlineKeys : keys.data(); } // Active key array
+	const K* keysData() const { return inlineStorage ? inlineKeys : keys.data(); } // Const overload
+	V* valuesData() { return inlineStorage ? inlineValues : values.data(); } // Active value array
+	const V* valuesData() const { return inlineStorage ? inlineValues : values.data(); } // Const overload
+	size_t* hashesData() { return inlineStorage ? inlineHashes : hashes.data(); } // Active hash cache
+	const size_t* hashesData() const { return inlineStorage ? inlineHashes : hashes.data(); } // Const overload
+
+	// Incremental resize state. In incremental mode a resize does not stop the world: the full
+	// arrays become the "old" table below, a double-sized empty table takes their place, and
+	// every subsequent mutating operation migrates a bounded number of old slots, so no single
+	// insert ever pays for rehashing the whole table. Lookups consult both tables while a
+	// migration is in flight.
+	bool incrementalMode; // Whether resizes migrate gradually instead of rebuilding in one pause
+	bool migrating; // Whether an incremental migration is currently in flight
+	size_t migratePos; // Next old-table slot to examine during migration
+	size_t oldSize; // Size of the old table while migrating, 0 otherwise
+	vector<unsigned char, MetaAllocator> oldMeta; // Old metadata array being drained by the migration
+	vector<K, KeyAllocator> oldKeys; // Old key array being drained by the migration
+	vector<V, ValueAllocator> oldValues; // Old value array being drained by the migration
+	vector<size_t, HashAllocator> oldHashes; // Old hash cache being drained by the migration
+
+	static constexpr int MIGRATE_STEP = 64; // Old slots examined per operation while a migration is in flight
+
+	// Hot-key front cache, for heavily skewed key distributions where a few hundred keys absorb
+	// most lookups. Each entry memoizes a recent probe result as (full hash, slot index), so a
+	// repeat lookup of a hot key verifies one slot directly instead of walking its group sequence:
+	// one cache-line touch in the tiny direct-mapped array plus the slot itself. The slot index is
+	// re-verified against the live metadata, cached hash, and key on every hit, so a stale entry
+	// degrades to a normal probe rather than a wrong answer; anything that renumbers slots
+	// (rehash, migration, deserialize) still drops the cache wholesale so no index can go out of
+	// bounds. Entries are promoted by a saturating frequency counter: a resident key must decay to
+	// zero before a competing key evicts it, which keeps genuinely hot keys resident through
+	// bursts of cold lookups. Off by default; the cache is mutable for the same reason as the
+	// probe statistics, so const lookups can promote.
+	static constexpr int HOT_CACHE_SLOTS = 8; // Direct-mapped entries; small enough to stay cache-resident
+
+	struct HotEntry { // One memoized probe result
+		size_t hash; // Full hash of the cached key, compared before touching the slot
+		size_t slot; // Live-table slot index the key was last found in
+		unsigned char freq; // Saturating frequency counter guarding the entry against eviction
+		bool valid; // Whether the entry holds anything at all
+    };
+
+	bool hotCacheEnabled; // Whether lookups consult the front cache, off by default
+	mutable HotEntry hotCache[HOT_CACHE_SLOTS]; // The direct-mapped entry array, indexed by hash
+
+	static int hotIndex(size_t h) { // The direct-mapped cache slot for a hash
+		return static_cast<int>(h & (HOT_CACHE_SLOTS - 1)); // Low hash bits pick the entry
     }
 
-	int hash2(const K& key) const { // Second hash function using modulo and prime
-		return 1 + (hash<K>{}(key) % (size - 1)); // Hash the key and take modulo of size - 1, add 1
+	void clearHotCache() const { // Drop every cached probe result
+		for (int i = 0; i < HOT_CACHE_SLOTS; ++i) { // Walk the entry array
+			hotCache[i].valid = false; // Invalidate the entry
+        }
     }
 
-	int doubleHash(const K& key, int i) const { // Double hashing function
-		int h1 = hash1(key); // First hash value
-		int h2 = hash2(key); // Second hash value
-		return (h1 + i * (h2 | 1)) % size;  // Double hashing formula.  Ensure h2 is odd
+	void promoteHot(size_t h, size_t slot) const { // Offer a fresh live-table probe result to the cache
+		HotEntry& e = hotCache[hotIndex(h)]; // The entry this hash maps to
+		if (e.valid && e.hash == h) { // The cache already tracks this key
+			e.slot = slot; // Refresh the slot in case the element moved
+			if (e.freq < 255) { e.freq++; } // Count the hit, saturating
+        }
+		else if (!e.valid || e.freq == 0) { // Entry is free, or its resident key has decayed cold
+			e.hash = h; e.slot = slot; e.freq = 1; e.valid = true; // Install the new key
+        }
+		else { // A still-warm resident key keeps the entry
+			e.freq--; // Decay it; repeated competition eventually evicts a cooled-off key
+        }
     }
 
-	void resize() { // Resize method to increase the size of the hash table
-		vector<pair<K, V>> oldTable = table; // Store old table
-		vector<bool> oldOccupied = occupied; // Store old occupied vector
-		int oldSize = size; // Store old size
-		size *= 2; // Double the size
-		table = vector<pair<K, V>>(size); // Create new table with new size
-		occupied = vector<bool>(size, false); // Create new occupied vector with new size
+	// Parallel build state. bulkLoad() and rehashParallel() spread slot-array construction over
+	// worker threads: workers claim free slots with casMeta() so any partition of the work is
+	// safe, and a bulk build of a large table ends up bound by memory bandwidth rather than by
+	// one core's probe throughput. resizeThreads carries the worker count into load-factor
+	// resizes so a table in this mode also migrates in parallel stripes when it outgrows itself.
+	size_t resizeThreads; // Worker threads a resize may use, 1 (serial) by default
+	static constexpr size_t BULK_SERIAL_CUTOFF = 4096; // Below this many elements, thread start-up costs more than the parallelism returns
+
+	static constexpr unsigned int SERIAL_MAGIC = 0x4C425448; // "HTBL" little-endian: first bytes of a serialized image
+	static constexpr unsigned int SERIAL_VERSION = 2; // Image format version, bumped on any layout change; version 2 widened size/count/tombstones to size_t
+
+	static unsigned char metaFragment(size_t h) { // The 7-bit hash fragment stored for an occupied slot
+		return static_cast<unsigned char>((h >> (sizeof(size_t) * 8 - 7)) & 0x7F); // Top bits of the hash, disjoint from the index bits
+    }
+
+	static bool isOccupied(unsigned char m) { // Whether a metadata byte marks a live slot
+		return (m & 0x80) == 0; // Sentinels have the high bit set, hash fragments do not
+    }
+
+	static constexpr int GROUP_SIZE = HASH_TABLE_GROUP_SIZE; // Metadata bytes probed per step, chosen at compile time
+
+	// Compare a whole metadata group against one byte and return a bitmask with bit j set when
+	// group[j] equals the byte. This is the kernel the probe loops are built on: one instruction
+	// filters 16 or 32 slots on SIMD targets, and the scalar fallback produces the same mask.
+	static unsigned int matchMask(const unsigned char* group, unsigned char value) { // Group-wide byte compare
+#if defined(HASH_TABLE_SIMD_AVX2) // 32-byte AVX2 kernel
+		__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group)); // Load the metadata group
+		__m256i needle = _mm256_set1_epi8(static_cast<char>(value)); // Broadcast the byte being searched for
+		return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle))); // One bit per matching slot
+#elif defined(HASH_TABLE_SIMD_SSE2) // 16-byte SSE2 kernel
+		__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)); // Load the metadata group
+		__m128i needle = _mm_set1_epi8(static_cast<char>(value)); // Broadcast the byte being searched for
+		return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle))); // One bit per matching slot
+#elif defined(HASH_TABLE_SIMD_NEON) // 16-byte NEON kernel
+		uint8x16_t eq = vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)); // Lane-wise compare, 0xFF on match
+		const uint8x16_t bits = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 }; // Per-lane bit weights
+		uint8x16_t masked = vandq_u8(eq, bits); // Keep one weight bit per matching lane
+		return static_cast<unsigned int>(vaddv_u8(vget_low_u8(masked))) // Sum the low half into bits 0-7
+			| (static_cast<unsigned int>(vaddv_u8(vget_high_u8(masked))) << 8); // Sum the high half into bits 8-15
+#else // Scalar fallback with identical semantics
+		unsigned int mask = 0; // Accumulated match mask
+		for (int j = 0; j < GROUP_SIZE; ++j) { // Scan the group a byte at a time
+			if (group[j] == value) { // If this slot's metadata matches
+				mask |= 1u << j; // Set the corresponding bit
+            }
+        }
+		return mask; // One bit per matching slot
+#endif
+    }
+
+	static int lowestSetBit(unsigned int mask) { // Index of the lowest set bit in a non-zero mask
+#if defined(_MSC_VER) && !defined(__clang__) // MSVC bit-scan intrinsic
+		unsigned long bit; // Receives the bit index
+		_BitScanForward(&bit, mask); // Scan from the least significant bit
+		return static_cast<int>(bit); // Return the index
+#else // GCC and Clang builtin
+		return __builtin_ctz(mask); // Count trailing zeros
+#endif
+    }
+
+	// Atomic primitives over single metadata bytes, used only by the parallel bulk-load and
+	// rehash workers. A worker claims a free slot by compare-and-swapping its metadata byte to
+	// META_CLAIMED, fills in the key, value, and cached hash, and then publishes the slot with a
+	// release store of its hash fragment. Concurrent probes treat a claimed byte exactly like a
+	// tombstone (the high bit is set, and only META_EMPTY ends a probe chain), so they skip past
+	// half-built slots without ever reading their key or value storage.
+	static bool casMeta(unsigned char* p, unsigned char expected, unsigned char desired) { // Claim one metadata byte atomically
+#if defined(_MSC_VER) && !defined(__clang__) // MSVC interlocked intrinsic
+		return _InterlockedCompareExchange8(reinterpret_cast<volatile char*>(p), // Compare-and-swap the byte
+			static_cast<char>(desired), static_cast<char>(expected)) == static_cast<char>(expected); // Success when the old value matched
+#else // GCC and Clang builtin
+		return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE); // Compare-and-swap the byte
+#endif
+    }
+
+	static void publishMeta(unsigned char* p, unsigned char value) { // Publish a claimed slot with release ordering
+#if defined(_MSC_VER) && !defined(__clang__) // MSVC interlocked intrinsic
+		_InterlockedExchange8(reinterpret_cast<volatile char*>(p), static_cast<char>(value)); // Full barrier: the slot's contents are visible first
+#else // GCC and Clang builtin
+		__atomic_store_n(p, value, __ATOMIC_RELEASE); // Release store: the slot's contents are visible first
+#endif
+    }
+
+	// Return a bitmask with bit j set when group[j] holds a live element. Occupancy is encoded in
+	// the high bit of each metadata byte (clear for hash fragments, set for the sentinels), so on
+	// SIMD targets this is a single movemask of the group with no compare at all. Iteration uses
+	// it to skip a whole group of empty or tombstoned slots per step instead of testing each byte.
+	static unsigned int occupiedMask(const unsigned char* group) { // Group-wide occupancy test
+#if defined(HASH_TABLE_SIMD_AVX2) // 32-byte AVX2 kernel
+		__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group)); // Load the metadata group
+		return ~static_cast<unsigned int>(_mm256_movemask_epi8(bytes)); // High bits mark sentinels; invert for occupancy
+#elif defined(HASH_TABLE_SIMD_SSE2) // 16-byte SSE2 kernel
+		__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)); // Load the metadata group
+		return ~static_cast<unsigned int>(_mm_movemask_epi8(bytes)) & 0xFFFFu; // High bits mark sentinels; invert for occupancy
+#elif defined(HASH_TABLE_SIMD_NEON) // 16-byte NEON kernel
+		uint8x16_t occ = vceqq_u8(vandq_u8(vld1q_u8(group), vdupq_n_u8(0x80)), vdupq_n_u8(0)); // 0xFF where the high bit is clear
+		const uint8x16_t bits = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 }; // Per-lane bit weights
+		uint8x16_t masked = vandq_u8(occ, bits); // Keep one weight bit per occupied lane
+		return static_cast<unsigned int>(vaddv_u8(vget_low_u8(masked))) // Sum the low half into bits 0-7
+			| (static_cast<unsigned int>(vaddv_u8(vget_high_u8(masked))) << 8); // Sum the high half into bits 8-15
+#else // Scalar fallback with identical semantics
+		unsigned int mask = 0; // Accumulated occupancy mask
+		for (int j = 0; j < GROUP_SIZE; ++j) { // Scan the group a byte at a time
+			if (isOccupied(group[j])) { // If this slot holds a live element
+				mask |= 1u << j; // Set the corresponding bit
+            }
+        }
+		return mask; // One bit per occupied slot
+#endif
+    }
+
+	// Find the first occupied slot at or after `from`, or return tableSize when none remains.
+	// The scan works a metadata group at a time over occupiedMask(), so a traversal of a sparse
+	// table skips GROUP_SIZE empty slots per iteration; tableSize is always a whole number of
+	// groups, making the full-group loads safe at the tail.
+	static size_t nextOccupied(const unsigned char* metaArr, size_t tableSize, size_t from) { // Group-wise occupied-slot scan
+		if (from >= tableSize) { // Cursor already past the end
+			return tableSize; // Nothing left to find
+        }
+		size_t base = from & ~static_cast<size_t>(GROUP_SIZE - 1); // Align the cursor down to its group boundary
+		unsigned int mask = occupiedMask(&metaArr[base]) & (~0u << static_cast<int>(from - base)); // Occupancy of the group, bits before the cursor cleared
+		while (mask == 0) { // While the current group holds no live slot
+			base += GROUP_SIZE; // Advance a whole group
+			if (base >= tableSize) { // Ran off the end of the table
+				return tableSize; // No occupied slot remains
+            }
+			mask = occupiedMask(&metaArr[base]); // Occupancy of the next group
+        }
+		return base + lowestSetBit(mask); // First occupied slot in the group
+    }
+
+	static size_t roundUpToPowerOfTwo(size_t s) { // Round a requested size up to the next power of two
+		size_t p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested size
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+	Hasher hasher; // The table's hash policy instance, default-constructed
+
+	// Compute the full hash of a key, exactly once per operation. The hash<string> special case
+	// is tested first: hash<string> is technically invocable with const char* too, but only by
+	// materializing a temporary string, so non-string probes of a default-hashed string table
+	// are routed through hash<string_view> (which the standard guarantees agrees with
+	// hash<string> for equal text) before generic invocability can allocate. Every other hasher
+	// that can consume the lookup key directly (including any transparent hasher) is called
+	// as-is. Anything else is a compile-time error rather than a silent wrong hash.
+	template <typename LK> // Lookup key type, convertible to or comparable with K
+	size_t hashKey(const LK& key) const { // Transparent hash dispatch
+		if constexpr (is_same_v<Hasher, hash<string>> && !is_same_v<LK, string> && is_convertible_v<const LK&, string_view>) { // Default-hashed string table probed with string-like text
+			return hash<string_view>{}(string_view(key)); // Hash the characters without allocating
+        }
+		else if constexpr (is_invocable_v<const Hasher&, const LK&>) { // Hasher understands this key type directly
+			return hasher(key); // Hash through the table's policy
+        }
+		else { // The policy cannot hash this probe type consistently
+			static_assert(is_invocable_v<const Hasher&, const LK&>, "Hasher cannot hash this lookup key type; use a transparent hash policy"); // Fail loudly at compile time
+			return 0; // Unreachable, keeps the compiler quiet
+        }
+    }
+
+	static size_t groupBaseFor(size_t h, size_t g, size_t tableSize) { // First slot of the g-th metadata group for a table of the given size
+		size_t groups = tableSize / GROUP_SIZE; // Number of metadata groups, a power of two
+		size_t home = (h & (tableSize - 1)) / GROUP_SIZE; // Home group from the masked hash
+		return ((home + g) & (groups - 1)) * GROUP_SIZE; // Groups are probed in sequence, wrapping with a bitmask
+    }
+
+	size_t groupBase(size_t h, size_t g) const { // First slot of the g-th metadata group on the key's probe path
+		return groupBaseFor(h, g, size); // Delegate using the live table's size
+    }
+
+	void rehash(size_t newSize) { // Rebuild the table at a caller-chosen power-of-two size
+		finishMigration(); // A stop-world rebuild subsumes any in-flight incremental migration
+		clearHotCache(); // Every slot index is about to change
+#if defined(HASH_TABLE_EVENTS) // Statistics surface compiled in
+		events.resizeCount++; // Count the rebuild
+		if (events.onResize != nullptr) { // If a resize callback is installed
+			events.onResize(size, newSize); // Report the transition to the caller
+        }
+#endif
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+		statResizeCount++; // Count the rebuild for getStats()
+#endif
+		bool wasInline = inlineStorage; // Whether the elements being rebuilt live in the inline block
+		vector<unsigned char, MetaAllocator> movedMeta = move(meta); // Move old metadata out instead of copying it
+		vector<K, KeyAllocator> movedKeys = move(keys); // Move old keys out
+		vector<V, ValueAllocator> movedValues = move(values); // Move old values out
+		vector<size_t, HashAllocator> movedHashes = move(hashes); // Move old cached hashes out
+		unsigned char* srcMeta = wasInline ? inlineMeta : movedMeta.data(); // Old metadata, wherever it lives
+		K* srcKeys = wasInline ? inlineKeys : movedKeys.data(); // Old keys, wherever they live
+		V* srcValues = wasInline ? inlineValues : movedValues.data(); // Old values, wherever they live
+		size_t* srcHashes = wasInline ? inlineHashes : movedHashes.data(); // Old hashes, wherever they live
+		size_t srcSize = size; // Store old size
+		size = newSize; // Adopt the new size, preserving the power-of-two invariant
+		inlineStorage = INLINE_CAPABLE && size <= INLINE_SLOTS; // A shrink back into one group returns to the inline block
+		if (inlineStorage) { // The rebuilt table fits inside the object; it cannot also have been inline, since newSize differs
+			fill(inlineMeta, inlineMeta + size, META_EMPTY); // Mark every inline slot empty
+        }
+		else { // The rebuilt table lives on the heap
+			meta = vector<unsigned char, MetaAllocator>(size, META_EMPTY, MetaAllocator(alloc)); // Create new metadata array with new size
+			keys = vector<K, KeyAllocator>(size, KeyAllocator(alloc)); // Create new key array with new size
+			values = vector<V, ValueAllocator>(size, ValueAllocator(alloc)); // Create new value array with new size
+			hashes = vector<size_t, HashAllocator>(size, HashAllocator(alloc)); // Create new hash cache with new size
+        }
 		count = 0; // Reset count to 0
+		tombstones = 0; // Tombstones are reclaimed: only live elements are reinserted
+
+		for (size_t i = 0; i < srcSize; ++i) { // Iterate over old table
+			if (isOccupied(srcMeta[i])) { // If slot holds a live element (tombstones are dropped)
+				placeSlot(srcHashes[i], move(srcKeys[i]), move(srcValues[i])); // Reuse the cached hash: rehash never re-hashes a key
+            }
+        }
+		if (wasInline) { // The inline block was the source and still holds moved-from elements
+			for (size_t i = 0; i < srcSize; ++i) { // Walk the inline slots
+				if (isOccupied(srcMeta[i])) { // If the slot held a live element
+					inlineKeys[i] = K(); // Drop the moved-from key so no resources linger in the object
+					inlineValues[i] = V(); // Drop the moved-from value for the same reason
+                }
+            }
+        }
+    }
+
+	void resize() { // Resize method to increase the size of the hash table
+		if (resizeThreads > 1) { // The table is configured for parallel resizes
+			rehashParallel(size * 2, resizeThreads); // Migrate the old table in parallel stripes
+        }
+		else { // Default serial mode
+			rehash(size * 2); // Double the size, preserving the power-of-two invariant
+        }
+    }
+
+	// This section rebuilds the table at a new size with worker threads, the parallel counterpart
+	// of rehash(). The old table is cut into contiguous stripes of whole metadata groups, one
+	// range per worker, and each worker re-places its stripe's live elements into the new arrays
+	// with parallelPlace(), claiming destination slots through casMeta() so stripes whose probe
+	// sequences collide never race. The elements of one table are distinct by construction, which
+	// is exactly the precondition parallelPlace() needs. Tables small enough that thread start-up
+	// would dominate fall back to the serial rebuild.
+	void rehashParallel(size_t newSize, size_t nThreads) { // Rebuild the table at a new size with worker threads
+		if (nThreads <= 1 || inlineStorage || count < BULK_SERIAL_CUTOFF) { // Too small for the parallelism to pay off
+			rehash(newSize); // The serial rebuild handles every small shape, including the inline block
+			return; // Nothing left to do
+        }
+		finishMigration(); // A stop-world rebuild subsumes any in-flight incremental migration
+		clearHotCache(); // Every slot index is about to change
+#if defined(HASH_TABLE_EVENTS) // Statistics surface compiled in
+		events.resizeCount++; // Count the rebuild
+		if (events.onResize != nullptr) { // If a resize callback is installed
+			events.onResize(size, newSize); // Report the transition to the caller
+        }
+#endif
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+		statResizeCount++; // Count the rebuild for getStats()
+#endif
+		vector<unsigned char, MetaAllocator> movedMeta = move(meta); // Move old metadata out instead of copying it
+		vector<K, KeyAllocator> movedKeys = move(keys); // Move old keys out
+		vector<V, ValueAllocator> movedValues = move(values); // Move old values out
+		vector<size_t, HashAllocator> movedHashes = move(hashes); // Move old cached hashes out
+		size_t srcSize = size; // Store old size
+		size = newSize; // Adopt the new size, preserving the power-of-two invariant
+		inlineStorage = false; // A table this large never shrinks back into the inline block here
+		meta = vector<unsigned char, MetaAllocator>(size, META_EMPTY, MetaAllocator(alloc)); // Create new metadata array with new size
+		keys = vector<K, KeyAllocator>(size, KeyAllocator(alloc)); // Create new key array with new size
+		values = vector<V, ValueAllocator>(size, ValueAllocator(alloc)); // Create new value array with new size
+		hashes = vector<size_t, HashAllocator>(size, HashAllocator(alloc)); // Create new hash cache with new size
+		tombstones = 0; // Tombstones are reclaimed: only live elements are reinserted
+		unsigned char* srcMeta = movedMeta.data(); // Old metadata array being drained
+		K* srcKeys = movedKeys.data(); // Old key array being drained
+		V* srcValues = movedValues.data(); // Old value array being drained
+		size_t* srcHashes = movedHashes.data(); // Old hash cache being drained
+		unsigned char* dstMeta = meta.data(); // New metadata array being filled
+		K* dstKeys = keys.data(); // New key array being filled
+		V* dstValues = values.data(); // New value array being filled
+		size_t* dstHashes = hashes.data(); // New hash cache being filled
+		size_t stripe = ((srcSize / nThreads) + GROUP_SIZE) & ~static_cast<size_t>(GROUP_SIZE - 1); // Old slots per worker, rounded to whole metadata groups
+		vector<size_t> placed(nThreads, 0); // Per-worker count of elements re-placed, summed after the join
+		vector<thread> workers; // The stripe workers
+		workers.reserve(nThreads); // One thread per stripe
+		for (size_t t = 0; t < nThreads; ++t) { // Launch one worker per stripe
+			size_t lo = t * stripe; // First old slot of this worker's stripe
+			size_t hi = (lo + stripe < srcSize) ? lo + stripe : srcSize; // One past the last old slot of the stripe
+			if (lo >= hi) { // More threads than stripes
+				break; // The remaining workers would have nothing to do
+            }
+			workers.emplace_back([=, &placed]() { // Each worker drains its stripe of the old table
+				size_t moved = 0; // Elements this worker re-placed
+				size_t reclaimed = 0; // Unused: a fresh table has no tombstones to reclaim
+				for (size_t i = nextOccupied(srcMeta, hi, lo); i < hi; i = nextOccupied(srcMeta, hi, i + 1)) { // Group-wise walk of the stripe's live slots
+					parallelPlace(dstMeta, dstKeys, dstValues, dstHashes, newSize, // Claim a new-table slot and move the element in,
+						srcHashes[i], move(srcKeys[i]), move(srcValues[i]), reclaimed); // reusing the cached hash: rehash never re-hashes a key
+					moved++; // Count the re-placed element
+                }
+				placed[t] = moved; // Publish the worker's tally for the join below
+            });
+        }
+		for (thread& worker : workers) { // Wait for every stripe to drain
+			worker.join(); // Block until this worker finishes
+        }
+		count = 0; // Recompute the element count from the workers' tallies
+		for (size_t t = 0; t < nThreads; ++t) { // Sum the per-worker counts
+			count += placed[t]; // Every live element was re-placed exactly once
+        }
+    }
 
-		for (int i = 0; i < oldSize; ++i) { // Iterate over old table
-			if (oldOccupied[i]) { // If slot is occupied
-				insert(oldTable[i].first, oldTable[i].second); // Insert key-value pair into new table
+	size_t sizeForElements(size_t n) const { // Smallest valid table size that holds n elements under the load factor
+		size_t needed = static_cast<size_t>(static_cast<double>(n) / maxLoadFactor) + 1; // Slots needed so n elements stay below the threshold
+		return roundUpToPowerOfTwo(needed < static_cast<size_t>(GROUP_SIZE) ? GROUP_SIZE : needed); // Round up to a power of two, at least one metadata group
+    }
+
+	void startIncrementalResize(size_t newSize) { // Begin a gradual migration into a larger table
+		if (inlineStorage) { // The table still fits in one group: a stop-world rebuild is already bounded
+			rehash(newSize); // Moving at most one group of elements needs no gradual draining
+			return; // Nothing to migrate
+        }
+		clearHotCache(); // Cached slots point into what is about to become the old table
+#if defined(HASH_TABLE_EVENTS) // Statistics surface compiled in
+		events.resizeCount++; // Count the rebuild
+		if (events.onResize != nullptr) { // If a resize callback is installed
+			events.onResize(size, newSize); // Report the transition to the caller
+        }
+#endif
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+		statResizeCount++; // Count the migration start for getStats()
+#endif
+		oldMeta = move(meta); // The live arrays become the old table being drained
+		oldKeys = move(keys); // Move the key array aside
+		oldValues = move(values); // Move the value array aside
+		oldHashes = move(hashes); // Move the hash cache aside
+		oldSize = size; // Remember the old table's size for probing and migration
+		migratePos = 0; // Migration starts from the first old slot
+		migrating = true; // Mark the migration in flight
+		size = newSize; // Adopt the new size, preserving the power-of-two invariant
+		tombstones = 0; // The fresh table starts with no tombstones; count still spans both tables
+		meta = vector<unsigned char, MetaAllocator>(size, META_EMPTY, MetaAllocator(alloc)); // Create the new metadata array
+		keys = vector<K, KeyAllocator>(size, KeyAllocator(alloc)); // Create the new key array
+		values = vector<V, ValueAllocator>(size, ValueAllocator(alloc)); // Create the new value array
+		hashes = vector<size_t, HashAllocator>(size, HashAllocator(alloc)); // Create the new hash cache
+    }
+
+	void migrateStep() { // Move a bounded number of old slots into the live table
+		int steps = MIGRATE_STEP; // Constant per-operation migration budget
+		while (steps-- > 0 && migratePos < oldSize) { // Examine at most MIGRATE_STEP old slots
+			if (isOccupied(oldMeta[migratePos])) { // If the old slot holds a live element
+				count--; // It leaves the old table; placeSlot counts it back into the live one
+				placeSlot(oldHashes[migratePos], move(oldKeys[migratePos]), move(oldValues[migratePos])); // Migrate with the cached hash, never re-hashing
+				oldMeta[migratePos] = META_DELETED; // Mark the old slot drained so lookups skip it
+            }
+			migratePos++; // Advance to the next old slot
+        }
+		if (migratePos >= oldSize) { // The whole old table has been drained
+			finishMigration(); // Release the old arrays
+        }
+    }
+
+	void finishMigration() { // Drain whatever remains of the old table and release it
+		if (!migrating) { // No migration in flight
+			return; // Nothing to do
+        }
+		while (migratePos < oldSize) { // Walk the rest of the old table
+			if (isOccupied(oldMeta[migratePos])) { // If the old slot holds a live element
+				count--; // It leaves the old table; placeSlot counts it back into the live one
+				placeSlot(oldHashes[migratePos], move(oldKeys[migratePos]), move(oldValues[migratePos])); // Migrate with the cached hash
             }
+			migratePos++; // Advance to the next old slot
         }
+		oldMeta = vector<unsigned char, MetaAllocator>(MetaAllocator(alloc)); // Release the old metadata array
+		oldKeys = vector<K, KeyAllocator>(KeyAllocator(alloc)); // Release the old key array
+		oldValues = vector<V, ValueAllocator>(ValueAllocator(alloc)); // Release the old value array
+		oldHashes = vector<size_t, HashAllocator>(HashAllocator(alloc)); // Release the old hash cache
+		oldSize = 0; // No old table any more
+		migratePos = 0; // Reset the migration cursor
+		migrating = false; // The table is whole again
+    }
+
+	template <typename KT, typename VT> // Forwarding reference types for key and value
+	void insertSlot(KT&& key, VT&& value); // Hashes the key once, then delegates to placeSlot
+
+	template <typename KT, typename VT> // Forwarding reference types for key and value
+	void placeSlot(size_t h, KT&& key, VT&& value); // Shared probe loop taking a precomputed hash
+
+	template <typename KT, typename VT> // Forwarding reference types for key and value
+	static bool parallelPlace(unsigned char* metaArr, K* keyArr, V* valArr, size_t* hashArr, // Thread-safe placement probe claiming slots
+		size_t tableSize, size_t h, KT&& key, VT&& value, size_t& reclaimedTombstones); // with casMeta(); returns whether a new slot was claimed
+
+	template <typename LK> // Lookup key type
+	const V* findSlot(size_t h, const LK& key) const; // Lookup over the live (and any migrating) arrays
+	template <typename LK> // Lookup key type
+	void removeSlot(size_t h, const LK& key); // Removal over the live (and any migrating) arrays
+
+	template <typename LK> // Lookup key type
+	static const V* probeFind(const unsigned char* metaArr, const K* keyArr, const V* valArr, // Raw-array lookup probe loop,
+		const size_t* hashArr, size_t tableSize, size_t h, const LK& key, int* probeGroups = nullptr); // shared by the live and old tables
+	template <typename LK> // Lookup key type
+	static bool probeRemove(unsigned char* metaArr, K* keyArr, V* valArr, // Raw-array removal probe loop,
+		size_t* hashArr, size_t tableSize, size_t h, const LK& key, int* probeGroups = nullptr); // returns whether a slot was tombstoned
+
+	template <typename MK, typename MV, typename MH> // Key, value, and hash policy of a mapped view
+	friend class MappedHashTableView; // MappedHashTableView (MappedHashTable.h) probes a serialized image with probeFind()
+
+#if defined(HASH_TABLE_STATS) // Instrumentation surface compiled in
+	// Raw counters behind getStats(). They are mutable because lookups through the const find()
+	// overloads are exactly the operations a latency investigation needs to see.
+	mutable long long statProbeHistogram[16] = {}; // Bucket i counts operations that probed i+1 metadata groups; the last bucket absorbs longer probes, the first also absorbs zero-group hot-cache hits
+	mutable long long statProbeCount = 0; // Operations recorded into the histogram
+	mutable long long statTotalProbeLength = 0; // Summed probe lengths in groups, for the mean
+	mutable long long statMaxProbeLength = 0; // Longest probe observed, in groups
+	long long statResizeCount = 0; // Rehashes plus incremental migrations started
+
+	void recordProbe(int groups) const { // Record one operation's probe length into the histogram
+		int bucket = groups - 1 < 15 ? groups - 1 : 15; // Clamp long probes into the overflow bucket
+		if (bucket < 0) { // A hot-cache hit resolves without walking any group
+			bucket = 0; // It shares the first bucket rather than indexing before the histogram
+        }
+		statProbeHistogram[bucket]++; // Count the operation in its bucket
+		statProbeCount++; // Count the operation overall
+		statTotalProbeLength += groups; // Accumulate for the mean
+		if (groups > statMaxProbeLength) { // New worst case
+			statMaxProbeLength = groups; // Remember it
+        }
+    }
+#endif
+
+	static constexpr int BATCH_WINDOW = 8; // Operations kept in flight per batch step to hide memory latency
+
+	void prefetchProbe(size_t h) const { // Issue a prefetch for the first metadata group on a key's probe path
+#if defined(HASH_TABLE_SIMD_AVX2) || defined(HASH_TABLE_SIMD_SSE2) // x86 prefetch intrinsic
+		_mm_prefetch(reinterpret_cast<const char*>(&metaData()[groupBase(h, 0)]), _MM_HINT_T0); // Pull the group into L1 ahead of the probe
+#elif defined(__GNUC__) || defined(__clang__) // GCC and Clang builtin
+		__builtin_prefetch(&metaData()[groupBase(h, 0)]); // Pull the group into cache ahead of the probe
+#else // No prefetch support: the batch APIs still work, just without latency hiding
+		(void)h; // Nothing to do
+#endif
     }
 
 // This section defines the public interface of the HashTable class.
 public: // Public section for external interface methods
-	HashTable(int s = DEFAULT_SIZE) : size(s), table(s), occupied(s, false), count(0) {} // Constructor with default size
-
-	void insert(const K& key, const V& value); // Method to insert key-value pair
-	V retrieve(const K& key) const; // Method to retrieve value for key
-	void remove(const K& key); // Method to remove key-value pair
-	int getSize() const { return size; } // Getter method for size
-	int getCount() const { return count; } // Getter method for count
-	void print() const; // Method to print the contents of the hash table
+	HashTable(size_t s = DEFAULT_SIZE, double loadFactor = 0.75, const Allocator& allocator = Allocator()) // Constructor taking an initial size, load-factor threshold, and allocator
+		: alloc(allocator), // Keep the allocator instance for every later array rebuild
+		size(roundUpToPowerOfTwo(s < GROUP_SIZE ? GROUP_SIZE : s)), count(0), tombstones(0), // Round the requested size up to a power of two, at least one metadata group
+		maxLoadFactor(loadFactor), // Adopt the caller's resize threshold
+		meta(MetaAllocator(alloc)), keys(KeyAllocator(alloc)), // Slot arrays start empty: small tables never allocate them
+		values(ValueAllocator(alloc)), hashes(HashAllocator(alloc)), // Slot arrays start empty: small tables never allocate them
+		inlineStorage(INLINE_CAPABLE && size <= INLINE_SLOTS), // A table fitting in one group lives inside the object
+		incrementalMode(false), migrating(false), migratePos(0), oldSize(0), // Incremental resize starts disabled with no migration in flight
+		oldMeta(MetaAllocator(alloc)), oldKeys(KeyAllocator(alloc)), // Old arrays stay empty until a migration begins
+		oldValues(ValueAllocator(alloc)), oldHashes(HashAllocator(alloc)), // Old arrays stay empty until a migration begins
+		hotCacheEnabled(false), resizeThreads(1) { // The hot-key front cache starts disabled and resizes start serial
+		clearHotCache(); // The front cache starts empty
+		if (inlineStorage) { // Small-table case: no heap allocation at all
+			fill(inlineMeta, inlineMeta + size, META_EMPTY); // Mark every inline slot empty
+        }
+		else { // The table is too large for the inline block
+			meta = vector<unsigned char, MetaAllocator>(size, META_EMPTY, MetaAllocator(alloc)); // Create metadata array at the rounded size
+			keys = vector<K, KeyAllocator>(size, KeyAllocator(alloc)); // Create key storage at the rounded size
+			values = vector<V, ValueAllocator>(size, ValueAllocator(alloc)); // Create value storage at the rounded size
+			hashes = vector<size_t, HashAllocator>(size, HashAllocator(alloc)); // Create hash cache at the rounded size
+        }
+    }
+
+	void insert(const K& key, const V& value) { insertSlot(key, value); } // Method to insert key-value pair by copy
+	void insert(K&& key, V&& value) { insertSlot(move(key), move(value)); } // Method to insert key-value pair by move
+	template <typename... Args> // Argument types forwarded to the value constructor
+	void emplace(K key, Args&&... args) { insertSlot(move(key), V(forward<Args>(args)...)); } // Method to construct the value in place from args
+	// The lookup and removal methods are templated on the probe key type LK, so a
+	// HashTable<string, V> can be probed with string_view or const char* without constructing a
+	// temporary string per call. LK only needs to be hashable (see hashKey) and comparable with K.
+	template <typename LK> // Lookup key type
+	V retrieve(const LK& key) const; // Method to retrieve value for key, throws if not found
+	template <typename LK> // Lookup key type
+	V* find(const LK& key); // Method to find value for key, returns nullptr if not found
+	template <typename LK> // Lookup key type
+	const V* find(const LK& key) const; // Const method to find value for key, returns nullptr if not found
+	template <typename LK> // Lookup key type
+	optional<reference_wrapper<V>> tryRetrieve(const LK& key); // Method to retrieve value for key without throwing or copying
+	template <typename LK> // Lookup key type
+	optional<reference_wrapper<const V>> tryRetrieve(const LK& key) const; // Const method to retrieve value for key without throwing or copying
+	template <typename LK> // Lookup key type
+	void remove(const LK& key); // Method to remove key-value pair
+	void insertBatch(const vector<K>& batchKeys, const vector<V>& batchValues); // Method to insert many pairs with prefetched probes
+	template <typename It> // Iterator over pair<K, V> items
+	void bulkLoad(It first, It last, size_t nThreads); // Method to build the table from a range with parallel workers
+	void retrieveBatch(const vector<K>& batchKeys, vector<const V*>& results) const; // Method to look up many keys into a caller-provided buffer
+	void removeBatch(const vector<K>& batchKeys); // Method to remove many keys with prefetched probes
+	size_t getSize() const { return size; } // Getter method for size
+	size_t getCount() const { return count; } // Getter method for count
+	double getMaxLoadFactor() const { return maxLoadFactor; } // Getter method for the load-factor threshold
+
+	void setMaxLoadFactor(double loadFactor) { // Setter method for the load-factor threshold
+		maxLoadFactor = loadFactor; // Adopt the new threshold
+		if (static_cast<double>(count + tombstones) / size > maxLoadFactor) { // If the table is already past it
+			resize(); // Grow immediately so the invariant holds
+        }
+    }
+
+	void reserve(size_t n) { // Size the table once for n elements, eliminating incremental resizes during a bulk load
+		size_t needed = sizeForElements(n); // Smallest size that keeps n elements under the load factor
+		if (needed > size) { // Only ever grow: reserve never discards capacity
+			rehash(needed); // One rehash instead of a doubling cascade
+        }
+    }
+
+	// Incremental resize mode: when enabled, a load-factor-triggered resize keeps the old and
+	// new tables live simultaneously and every subsequent mutating operation migrates at most
+	// MIGRATE_STEP old slots, so no single insert ever pays for rehashing the whole table.
+	// Explicit rebuilds (reserve, shrinkToFit, rehash) still run to completion in one step.
+	void setIncrementalResize(bool on) { // Enable or disable incremental resizing
+		incrementalMode = on; // Adopt the new mode
+		if (!on) { // Turning the mode off
+			finishMigration(); // Complete any migration still in flight
+        }
+    }
+
+	bool getIncrementalResize() const { return incrementalMode; } // Getter method for the incremental resize mode
+
+	// Hot-key front cache mode: when enabled, lookups first check a small direct-mapped cache of
+	// recent probe results before walking the group sequence, so a skewed workload resolves its
+	// hottest keys in one verified slot access. The cache costs one branch per lookup when the
+	// distribution is flat, so it is opt-in.
+	void setHotKeyCache(bool on) { // Enable or disable the hot-key front cache
+		hotCacheEnabled = on; // Adopt the new mode
+		clearHotCache(); // Start from an empty cache either way
+    }
+
+	bool getHotKeyCache() const { return hotCacheEnabled; } // Getter method for the hot-key cache mode
+
+	// Parallel resize mode: when a worker count above one is set, load-factor resizes and the
+	// up-front grow inside bulkLoad() rebuild the table in parallel stripes via rehashParallel().
+	// Serial by default: spawning threads inside a single insert only pays for itself on large
+	// tables, so the mode is opt-in for bulk-build phases.
+	void setResizeThreads(size_t n) { // Setter method for the resize worker count
+		resizeThreads = (n == 0) ? 1 : n; // Clamp zero to serial so resize() never divides by nothing
+    }
+
+	size_t getResizeThreads() const { return resizeThreads; } // Getter method for the resize worker count
+
+	void shrinkToFit() { // Release memory after bulk deletes by rebuilding at the smallest valid size
+		size_t needed = sizeForElements(count); // Smallest size that holds the current elements
+		if (needed < size) { // Only shrink when it actually saves space
+			rehash(needed); // Rebuild, which also reclaims all tombstones
+        }
+    }
+
+	void print(ostream& out) const; // Method to print the contents of the hash table to a caller-provided stream
 	void clear(); // Method to clear the hash table
+	void serialize(ostream& out); // Method to write the table as a versioned binary image
+	void deserialize(istream& in); // Method to reload a binary image without re-probing
+
+	// This section defines iteration over the occupied slots. Iterators walk the metadata array in
+	// memory order, so a full traversal streams the slot arrays sequentially instead of chasing a
+	// probe order, which is what bulk export jobs need. While a migration is in flight the live
+	// table is walked first and then the not-yet-migrated remainder of the old one. Iterators are
+	// invalidated by any operation that can resize or migrate the table.
+	class const_iterator { // Forward iterator over occupied slots, yielding key/value reference pairs
+	private: // Private section for the iterator's cursor state
+		const HashTable* table; // The table being walked
+		size_t index; // Combined slot cursor: live slots first, then old-table slots while migrating
+		friend class HashTable; // Only the table constructs iterators
+
+		void advance() { // Skip forward to the next occupied slot, or the end
+			if (index < table->size) { // Cursor is in the live table
+				index = nextOccupied(table->metaData(), table->size, index); // Group-wise skip over empty and tombstoned slots
+            }
+			if (index >= table->size && table->migrating) { // Live table exhausted while a migration is in flight
+				index = table->size + nextOccupied(table->oldMeta.data(), table->oldSize, index - table->size); // Continue in the old table
+            }
+        }
+		const_iterator(const HashTable* t, size_t i) : table(t), index(i) { advance(); } // Constructor starting at a slot and settling on an occupied one
+
+	public: // Public section for the iterator interface
+		pair<const K&, const V&> operator*() const { // Dereference to the slot's key and value
+			if (index < table->size) { // Live-table slot
+				return { table->keysData()[index], table->valuesData()[index] }; // References into the live arrays
+            }
+			return { table->oldKeys[index - table->size], table->oldValues[index - table->size] }; // References into the old arrays
+        }
+		const_iterator& operator++() { index++; advance(); return *this; } // Step to the next occupied slot
+		bool operator==(const const_iterator& other) const { return index == other.index; } // Iterators over one table compare by cursor
+		bool operator!=(const const_iterator& other) const { return index != other.index; } // Inequality is the negation
+    };
+
+	const_iterator begin() const { return const_iterator(this, 0); } // First occupied slot, for range-for
+	const_iterator end() const { return const_iterator(this, size + (migrating ? oldSize : 0)); } // One past the last slot
+
+	// Visit every occupied slot in memory order, calling f(key, value). This is the fast path for
+	// bulk export: one pass over the dense metadata bytes with no iterator object per step.
+	template <typename F> // Callable taking (const K&, V&)
+	void forEach(F&& f) { // Mutable traversal implementation
+		for (size_t i = nextOccupied(metaData(), size, 0); i < size; i = nextOccupied(metaData(), size, i + 1)) { // Jump occupied-to-occupied, a group at a time
+			f(keysData()[i], valuesData()[i]); // Visit it; the value is mutable in place
+        }
+		if (migrating) { // A migration is in flight
+			for (size_t i = nextOccupied(oldMeta.data(), oldSize, 0); i < oldSize; i = nextOccupied(oldMeta.data(), oldSize, i + 1)) { // Walk the old metadata array too
+				f(oldKeys[i], oldValues[i]); // Visit it where it still lives
+            }
+        }
+    }
+
+	template <typename F> // Callable taking (const K&, const V&)
+	void forEach(F&& f) const { // Const traversal implementation
+		for (size_t i = nextOccupied(metaData(), size, 0); i < size; i = nextOccupied(metaData(), size, i + 1)) { // Jump occupied-to-occupied, a group at a time
+			f(static_cast<const K&>(keysData()[i]), static_cast<const V&>(valuesData()[i])); // Visit it read-only
+        }
+		if (migrating) { // A migration is in flight
+			for (size_t i = nextOccupied(oldMeta.data(), oldSize, 0); i < oldSize; i = nextOccupied(oldMeta.data(), oldSize, i + 1)) { // Walk the old metadata array too
+				f(static_cast<const K&>(oldKeys[i]), static_cast<const V&>(oldValues[i])); // Visit it read-only
+            }
+        }
+    }
+
+#if defined(HASH_TABLE_EVENTS) // Statistics surface compiled in
+	struct Events { // Counters and optional callbacks for table-level events
+		void (*onResize)(size_t oldSize, size_t newSize) = nullptr; // Fired before a rehash rebuilds the table
+		void (*onFailedInsert)(size_t size, size_t count) = nullptr; // Fired when an insert cannot find a slot
+		long long resizeCount = 0; // Number of rehashes over the table's lifetime
+		long long failedInsertCount = 0; // Number of inserts that threw for lack of a slot
+    };
+
+	Events events; // Per-table event surface, callbacks null and counters zero by default
+#endif
+
+#if defined(HASH_TABLE_STATS) // Instrumentation surface compiled in
+	struct Stats { // Point-in-time snapshot of the table's probe and occupancy statistics
+		static constexpr int PROBE_BUCKETS = 16; // Histogram buckets: bucket i counts operations that probed i+1 metadata groups
+		long long probeHistogram[PROBE_BUCKETS]; // Per-operation probe lengths; the last bucket absorbs longer probes
+		long long probeCount; // Operations recorded into the histogram
+		long long totalProbeLength; // Summed probe lengths in groups; divide by probeCount for the mean
+		long long maxProbeLength; // Longest probe observed, in groups
+		long long resizeCount; // Rehashes plus incremental migrations started over the table's lifetime
+		double tombstoneRatio; // Tombstoned fraction of the table's slots right now
+		size_t size; // Table size at snapshot time
+		size_t count; // Element count at snapshot time
+		size_t tombstones; // Tombstone count at snapshot time
+    };
+
+	Stats getStats() const { // Snapshot the statistics for the metrics pipeline
+		Stats s; // The snapshot being filled
+		for (int i = 0; i < Stats::PROBE_BUCKETS; ++i) { // Copy the histogram buckets
+			s.probeHistogram[i] = statProbeHistogram[i]; // One bucket at a time
+        }
+		s.probeCount = statProbeCount; // Copy the operation count
+		s.totalProbeLength = statTotalProbeLength; // Copy the probe-length sum
+		s.maxProbeLength = statMaxProbeLength; // Copy the worst case
+		s.resizeCount = statResizeCount; // Copy the resize count
+		s.tombstoneRatio = static_cast<double>(tombstones) / size; // Compute the current tombstone ratio
+		s.size = size; // Record the table size
+		s.count = count; // Record the element count
+		s.tombstones = tombstones; // Record the tombstone count
+		return s; // Return the snapshot by value
+    }
+
+	void resetStats() { // Zero the counters, e.g. at the start of a measurement window
+		for (int i = 0; i < Stats::PROBE_BUCKETS; ++i) { // Clear the histogram buckets
+			statProbeHistogram[i] = 0; // One bucket at a time
+        }
+		statProbeCount = 0; // Clear the operation count
+		statTotalProbeLength = 0; // Clear the probe-length sum
+		statMaxProbeLength = 0; // Clear the worst case
+		statResizeCount = 0; // Clear the resize count
+    }
+#endif
 };
 
 // This section adds a key-value pair to the hash table, resizing if necessary and handling collisions.
-template <typename K, typename V> // Template for key-value pair types
-void HashTable<K, V>::insert(const K& key, const V& value) { // Insert method implementation
-	if (static_cast<double>(count) / size > 0.75) { // Check load factor
-		cout << "Resizing from " << size << " to " << size * 2 << endl; // Output resize message
-		resize(); // Resize the hash table
-    }
-
-	int i = 0; // Initialize probe count
-	while (i < size) { // Iterate over table
-		int index = doubleHash(key, i); // Calculate index using double hashing
-		if (!occupied[index] || table[index].first == key) { // If slot is empty or key matches
-			table[index] = make_pair(key, value); // Insert key-value pair
-			if (!occupied[index]) { // If slot was empty
-				occupied[index] = true; // Mark slot as occupied
-				count++; // Increment count
+// It is shared by the copying and moving insert() overloads and by emplace(), forwarding the key
+// and value into the slot so rvalue arguments are moved rather than copied. The key is hashed
+// exactly once here; every probe step below works from that single value.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename KT, typename VT> // Forwarding reference types for key and value
+void HashTable<K, V, Hasher, Allocator>::insertSlot(KT&& key, VT&& value) { // Insert implementation shared by all flavors
+	size_t h = hashKey(key); // Hash the key exactly once for everything below
+	if (migrating) { // A gradual migration is in flight
+		migrateStep(); // Pay this operation's bounded share of the migration
+    }
+	else if (static_cast<double>(count + tombstones) / size > maxLoadFactor) { // Check load factor, counting tombstones as occupied
+		if (incrementalMode) { // Gradual mode: start draining into a bigger table
+			startIncrementalResize(size * 2); // No element moves yet; later operations pay in bounded steps
+        }
+		else { // Classic mode
+			resize(); // Resize the hash table in one step
+        }
+    }
+	if (migrating && probeRemove(oldMeta.data(), oldKeys.data(), oldValues.data(), oldHashes.data(), oldSize, h, key)) { // The key may still live in the old table
+		count--; // Drop the old copy so the insert below is an update, not a duplicate
+    }
+	placeSlot(h, forward<KT>(key), forward<VT>(value)); // Probe with the cached hash; new elements always land in the live table
+}
+
+// This section is the probe loop behind insertSlot() and resize(). It takes the key's hash as a
+// parameter so resize() can reuse the per-slot cache and never re-hash a key. Each step scans a
+// whole metadata group with matchMask(): candidate slots are confirmed against the cached hash
+// and then the key, a free slot (empty or tombstone) is remembered for the insert itself, and a
+// group containing an empty byte ends the probe because the key cannot live beyond it.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename KT, typename VT> // Forwarding reference types for key and value
+void HashTable<K, V, Hasher, Allocator>::placeSlot(size_t h, KT&& key, VT&& value) { // Probe loop taking a precomputed hash
+	unsigned char* metaArr = metaData(); // Active metadata array, inline or heap
+	K* keyArr = keysData(); // Active key array
+	V* valArr = valuesData(); // Active value array
+	size_t* hashArr = hashesData(); // Active hash cache
+	unsigned char fragment = metaFragment(h); // 7-bit fragment this key will store in the metadata array
+	size_t firstFree = NPOS; // First empty or tombstoned slot seen on the probe path, reusable for the new element
+	size_t groups = size / GROUP_SIZE; // Number of metadata groups to probe at most
+	for (size_t g = 0; g < groups; ++g) { // Walk the key's group sequence
+		size_t base = groupBase(h, g); // First slot of this metadata group
+		unsigned int candidates = matchMask(&metaArr[base], fragment); // Slots whose metadata byte matches the fragment
+		while (candidates != 0) { // Check each candidate slot
+			size_t index = base + lowestSetBit(candidates); // Slot index of the lowest remaining candidate
+			candidates &= candidates - 1; // Clear that candidate from the mask
+			if (hashArr[index] == h && keyArr[index] == key) { // Cached hash filters out mismatches before the key compare
+				valArr[index] = forward<VT>(value); // Key already present: overwrite the value in place
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+				recordProbe(static_cast<int>(g) + 1); // This insert probed g+1 groups before overwriting
+#endif
+				return; // Exit loop
+            }
+        }
+		if (firstFree == NPOS) { // No insertion slot chosen yet
+			unsigned int free = matchMask(&metaArr[base], META_EMPTY) | matchMask(&metaArr[base], META_DELETED); // Slots that could hold the new element
+			if (free != 0) { // If this group has a free slot
+				firstFree = base + lowestSetBit(free); // Remember the first one in probe order
+            }
+        }
+		if (matchMask(&metaArr[base], META_EMPTY) != 0) { // An empty byte ends the probe chain: key is not present
+			if (metaArr[firstFree] == META_DELETED) { // If the chosen slot is a tombstone
+				tombstones--; // One fewer tombstone in the table
             }
+			keyArr[firstFree] = forward<KT>(key); // Forward key into slot (moves for rvalues)
+			valArr[firstFree] = forward<VT>(value); // Forward value into slot (moves for rvalues)
+			hashArr[firstFree] = h; // Cache the full hash so resize and later probes never re-hash this key
+			metaArr[firstFree] = fragment; // Publish the slot as occupied with its hash fragment
+			count++; // Increment count
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+			recordProbe(static_cast<int>(g) + 1); // This insert probed g+1 groups before placing the element
+#endif
 			return; // Exit loop
         }
-		i++; // Increment probe count
     }
-	cout << "Failed to insert key " << key << ". Table size: " << size << ", Count: " << count << endl; // Output failure message
+	if (firstFree != NPOS) { // Every group was full of live and tombstoned slots, but a tombstone exists
+		keyArr[firstFree] = forward<KT>(key); // Forward key into the tombstone slot
+		valArr[firstFree] = forward<VT>(value); // Forward value into the tombstone slot
+		hashArr[firstFree] = h; // Cache the full hash for the reclaimed slot
+		metaArr[firstFree] = fragment; // Publish the reclaimed slot as occupied
+		tombstones--; // One fewer tombstone in the table
+		count++; // Increment count
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+		recordProbe(static_cast<int>(groups)); // This insert scanned every group before reclaiming a tombstone
+#endif
+		return; // Insert succeeded by reclaiming a tombstone
+    }
+#if defined(HASH_TABLE_EVENTS) // Statistics surface compiled in
+	events.failedInsertCount++; // Count the failed insert
+	if (events.onFailedInsert != nullptr) { // If a failure callback is installed
+		events.onFailedInsert(size, count); // Report the table state to the caller
+    }
+#endif
+	throw runtime_error("Hash table is full"); // Throw exception if table is full
+}
+
+// This section is the thread-safe placement probe behind bulkLoad() and rehashParallel(). Any
+// number of workers may run it concurrently over the same arrays, under one precondition: no two
+// workers place the same key. Placement happens in two passes. The first pass is read-only and
+// looks for the key among slots that existed before the workers started; those never move, so
+// the scan is race-free, and a concurrently published slot cannot hold this worker's key by the
+// precondition (the cached-hash filter keeps such a slot from even being key-compared unless its
+// full 64-bit hash collides). The second pass claims a free slot in probe order: casMeta() takes
+// the slot's metadata byte to META_CLAIMED, the key, value, and hash are written, and
+// publishMeta() makes the slot visible in one release store. A lost claim just rescans the
+// group. Group scans deliberately keep the ordinary non-atomic SIMD loads (per-byte atomic
+// loads would forfeit the matchMask() kernel): a byte cannot tear, and a stale mask only sends
+// the probe through the re-read and compare-and-swap, which settle every claim authoritatively.
+// Counters are left to the caller, which sums per-worker tallies after joining; probe
+// statistics are not recorded, since the histogram is not thread-safe.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename KT, typename VT> // Forwarding reference types for key and value
+bool HashTable<K, V, Hasher, Allocator>::parallelPlace(unsigned char* metaArr, K* keyArr, V* valArr, // Thread-safe placement probe
+	size_t* hashArr, size_t tableSize, size_t h, KT&& key, VT&& value, size_t& reclaimedTombstones) { // over caller-provided arrays
+	unsigned char fragment = metaFragment(h); // 7-bit fragment this key will store in the metadata array
+	size_t groups = tableSize / GROUP_SIZE; // Number of metadata groups to probe at most
+	for (size_t g = 0; g < groups; ++g) { // First pass: find the key if it is already resident
+		size_t base = groupBaseFor(h, g, tableSize); // First slot of this metadata group
+		unsigned int candidates = matchMask(&metaArr[base], fragment); // Slots whose metadata byte matches the fragment
+		while (candidates != 0) { // Check each candidate slot
+			size_t index = base + lowestSetBit(candidates); // Slot index of the lowest remaining candidate
+			candidates &= candidates - 1; // Clear that candidate from the mask
+			if (hashArr[index] == h && keyArr[index] == key) { // Cached hash filters out mismatches before the key compare
+				valArr[index] = forward<VT>(value); // Key already present: overwrite the value in place; no other worker touches this key
+				return false; // No new slot was claimed
+            }
+        }
+		if (matchMask(&metaArr[base], META_EMPTY) != 0) { // An empty byte ends the probe chain: key is not present
+			break; // Move on to claiming a slot
+        }
+    }
+	for (size_t g = 0; g < groups; ++g) { // Second pass: claim a free slot in probe order
+		size_t base = groupBaseFor(h, g, tableSize); // First slot of this metadata group
+		while (true) { // Retry within the group until it is claimed out from under us
+			unsigned int free = matchMask(&metaArr[base], META_EMPTY) | matchMask(&metaArr[base], META_DELETED); // Slots that could hold the new element
+			if (free == 0) { // Every slot in the group is live or claimed
+				break; // Probe the next group
+            }
+			size_t index = base + lowestSetBit(free); // First free slot in the group
+			unsigned char expected = metaArr[index]; // Re-read the byte: the mask may be stale by now
+			if (expected != META_EMPTY && expected != META_DELETED) { // Another worker claimed it between the mask and the read
+				continue; // Rescan the group for the next free byte
+            }
+			if (casMeta(&metaArr[index], expected, META_CLAIMED)) { // Claim the slot; losers fall through and rescan
+				keyArr[index] = forward<KT>(key); // Forward key into the claimed slot (moves for rvalues)
+				valArr[index] = forward<VT>(value); // Forward value into the claimed slot (moves for rvalues)
+				hashArr[index] = h; // Cache the full hash so resize and later probes never re-hash this key
+				publishMeta(&metaArr[index], fragment); // Publish the slot as occupied; its contents are visible first
+				if (expected == META_DELETED) { // The claimed slot was a tombstone
+					reclaimedTombstones++; // Report the reclamation for the caller's tombstone accounting
+                }
+				return true; // A new slot was claimed
+            }
+        }
+    }
 	throw runtime_error("Hash table is full"); // Throw exception if table is full
 }
 
 // This section searches for a key and returns its associated value, throwing an exception if not found.
-template <typename K, typename V> // Template for key-value pair types
-V HashTable<K, V>::retrieve(const K& key) const { // Retrieve method implementation
-	int i = 0; // Initialize probe count
-	while (i < size) { // Iterate over table
-		int index = doubleHash(key, i); // Calculate index using double hashing
-		if (!occupied[index]) { // If slot is empty
-			break;  // Key not found
-        }
-		if (table[index].first == key) { // If key matches
-			return table[index].second; // Return value
-        }
-		i++; // Increment probe count
-    }
-	throw runtime_error("Key not found"); // Throw exception if key is not found
-}
-
-// This section deletes a key-value pair from the hash table and rehashes subsequent elements.
-template <typename K, typename V> // Template for key-value pair types
-void HashTable<K, V>::remove(const K& key) { // Remove method implementation
-	int i = 0; // Initialize probe count
-	while (i < size) { // Iterate over table
-		int index = doubleHash(key, i); // Calculate index using double hashing
-		if (!occupied[index]) {  // If slot is empty
-			return;  // Key not found
-        }
-		if (table[index].first == key) { // If key matches
-			occupied[index] = false; // Mark slot as empty
-			count--; // Decrement count
-			//cout << "Removed key " << key << ". New count: " << count << endl; // Output removal message.  Be careful, this line can slow down the program
-			// and print a lot of output to screen.
-
-			// Rehash the elements after the removed key
-			int j = (index + 1) % size; // Start rehashing from next index
-			while (occupied[j]) { // Iterate over occupied slots
-				K rehashKey = table[j].first; // Store key for rehashing
-				V rehashValue = table[j].second; // Store value for rehashing
-				occupied[j] = false; // Mark slot as empty
-				count--; // Decrement count
-				insert(rehashKey, rehashValue); // Reinsert key-value pair
-				j = (j + 1) % size; // Move to next index
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+V HashTable<K, V, Hasher, Allocator>::retrieve(const LK& key) const { // Retrieve method implementation
+	const V* value = find(key); // Probe for the key without throwing
+	if (value == nullptr) { // If key was not found
+		throw runtime_error("Key not found"); // Throw exception if key is not found
+    }
+	return *value; // Return a copy of the value
+}
+
+// This section searches for a key and returns a pointer to its value, or nullptr on a miss.
+// Unlike retrieve() it never throws and never copies the value, so it is the right call
+// for miss-heavy workloads where an exception per miss would dominate the probe cost.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+const V* HashTable<K, V, Hasher, Allocator>::find(const LK& key) const { // Const find method implementation
+	return findSlot(hashKey(key), key); // Hash the key exactly once, then probe
+}
+
+// This section is the raw-array lookup probe loop, parameterized on the arrays and table size so
+// the same code probes the live table and, while a migration is in flight, the old one.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+const V* HashTable<K, V, Hasher, Allocator>::probeFind(const unsigned char* metaArr, const K* keyArr, const V* valArr, // Raw-array lookup probe loop,
+	const size_t* hashArr, size_t tableSize, size_t h, const LK& key, int* probeGroups) { // shared by the live and old tables
+	unsigned char fragment = metaFragment(h); // 7-bit fragment to scan for in the metadata array
+	size_t groups = tableSize / GROUP_SIZE; // Number of metadata groups to probe at most
+	for (size_t g = 0; g < groups; ++g) { // Walk the key's group sequence
+		size_t base = groupBaseFor(h, g, tableSize); // First slot of this metadata group
+		unsigned int candidates = matchMask(&metaArr[base], fragment); // Slots whose metadata byte matches the fragment
+		while (candidates != 0) { // Check each candidate slot
+			size_t index = base + lowestSetBit(candidates); // Slot index of the lowest remaining candidate
+			candidates &= candidates - 1; // Clear that candidate from the mask
+			if (hashArr[index] == h && keyArr[index] == key) { // Cached hash filters out mismatches before the key compare
+				if (probeGroups != nullptr) { *probeGroups = static_cast<int>(g) + 1; } // Report the probe length to an instrumented caller
+				return &valArr[index]; // Return pointer to value
             }
-			return; // Exit loop
         }
-		i++; // Increment probe count
+		if (matchMask(&metaArr[base], META_EMPTY) != 0) { // An empty byte ends the probe chain
+			if (probeGroups != nullptr) { *probeGroups = static_cast<int>(g) + 1; } // Report the probe length to an instrumented caller
+			return nullptr;  // Key not found
+        }
     }
+	if (probeGroups != nullptr) { *probeGroups = static_cast<int>(groups); } // Report the full-table scan to an instrumented caller
+	return nullptr; // Key not found after probing the whole table
 }
 
-// This section displays all occupied slots in the hash table, including their keys and values.
-template <typename K, typename V> // Template for key-value pair types
-void HashTable<K, V>::print() const { // Print method implementation
-	for (int i = 0; i < size; ++i) { // Iterate over table
-		if (occupied[i]) { // If slot is occupied
-			cout << "Index " << i << ": Key = " << table[i].first // Output key-value pair
-				<< ", Value = " << table[i].second << endl; // Output key-value pair
+// This section is the lookup probe loop, taking the key's hash as a parameter so batch callers
+// can compute and prefetch hashes ahead of the probes that consume them. While a migration is in
+// flight an element not yet migrated still lives in the old table, so a miss falls through to it.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+const V* HashTable<K, V, Hasher, Allocator>::findSlot(size_t h, const LK& key) const { // Lookup probe loop implementation
+	if (hotCacheEnabled) { // The front cache is in play
+		HotEntry& e = hotCache[hotIndex(h)]; // The entry this hash maps to
+		if (e.valid && e.hash == h // The cache tracks this hash
+			&& isOccupied(metaData()[e.slot]) && hashesData()[e.slot] == h && keysData()[e.slot] == key) { // And the slot still holds the key
+			if (e.freq < 255) { e.freq++; } // Count the hit, saturating
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in
+			recordProbe(0); // The lookup resolved without walking any group
+#endif
+			return &valuesData()[e.slot]; // One verified slot access instead of a probe walk
         }
     }
-	cout << "Size: " << size << ", Count: " << count << endl; // Output size and count
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in: measure the probe
+	int probeGroups = 0; // Groups this lookup examined, across both tables
+	const V* value = probeFind(metaData(), keysData(), valuesData(), hashesData(), size, h, key, &probeGroups); // Probe the live table first
+	bool liveHit = value != nullptr; // Whether the hit landed in the live arrays, where the cache can point
+	if (value == nullptr && migrating) { // Miss with a migration in flight
+		int oldGroups = 0; // Groups examined in the old table
+		value = probeFind(oldMeta.data(), oldKeys.data(), oldValues.data(), oldHashes.data(), oldSize, h, key, &oldGroups); // The element may not have migrated yet
+		probeGroups += oldGroups; // The lookup paid for both probes
+    }
+	recordProbe(probeGroups); // Feed the histogram
+#else // Instrumentation compiled out: the plain probe
+	const V* value = probeFind(metaData(), keysData(), valuesData(), hashesData(), size, h, key); // Probe the live table first
+	bool liveHit = value != nullptr; // Whether the hit landed in the live arrays, where the cache can point
+	if (value == nullptr && migrating) { // Miss with a migration in flight
+		value = probeFind(oldMeta.data(), oldKeys.data(), oldValues.data(), oldHashes.data(), oldSize, h, key); // The element may not have migrated yet
+    }
+#endif
+	if (hotCacheEnabled && liveHit) { // A live-table hit is a candidate for the front cache
+		promoteHot(h, static_cast<size_t>(value - valuesData())); // Offer its slot to the frequency-guarded entry
+    }
+	return value; // Pointer to the value, or nullptr after both tables missed
 }
 
-// This section resets the hash table to an empty state, maintaining its current size.
-template <typename K, typename V> // Template for key-value pair types
-void HashTable<K, V>::clear() { // Clear method implementation
-	table = vector<pair<K, V>>(size); // Create new table with same size
-	occupied = vector<bool>(size, false); // Create new occupied vector with same size
+// This section provides the mutable find overload by delegating to the const implementation.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+V* HashTable<K, V, Hasher, Allocator>::find(const LK& key) { // Mutable find method implementation
+	if (migrating) { // A gradual migration is in flight
+		migrateStep(); // Mutable access may pay a migration share; the const overload never mutates
+    }
+	return const_cast<V*>(static_cast<const HashTable*>(this)->find(key)); // Reuse the const probe loop
+}
+
+// This section wraps find() in an optional so callers can test for presence without pointers.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+optional<reference_wrapper<V>> HashTable<K, V, Hasher, Allocator>::tryRetrieve(const LK& key) { // Non-throwing retrieve implementation
+	V* value = find(key); // Probe for the key without throwing
+	if (value == nullptr) { // If key was not found
+		return nullopt; // Signal the miss without an exception
+    }
+	return ref(*value); // Return a reference to the value without copying
+}
+
+// This section is the const counterpart of tryRetrieve(), yielding a const reference on a hit.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+optional<reference_wrapper<const V>> HashTable<K, V, Hasher, Allocator>::tryRetrieve(const LK& key) const { // Const non-throwing retrieve implementation
+	const V* value = find(key); // Probe for the key without throwing
+	if (value == nullptr) { // If key was not found
+		return nullopt; // Signal the miss without an exception
+    }
+	return cref(*value); // Return a const reference to the value without copying
+}
+
+// This section deletes a key-value pair by tombstoning its slot, making remove O(probe length).
+// The old cascading rehash reinserted every element in the following occupied run, which at high
+// load reinserted thousands of entries per delete and assumed linear probing rather than the
+// double-hashed probe sequences actually in use. Tombstones keep probe chains intact for other
+// keys and are reclaimed wholesale the next time the table resizes.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+void HashTable<K, V, Hasher, Allocator>::remove(const LK& key) { // Remove method implementation
+	removeSlot(hashKey(key), key); // Hash the key exactly once, then probe
+}
+
+// This section is the raw-array removal probe loop, the mutating counterpart of probeFind(). It
+// tombstones the slot and reports whether one was found, leaving count and tombstone accounting
+// to the caller, because a hit in the old table affects count but not the live tombstone total.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+bool HashTable<K, V, Hasher, Allocator>::probeRemove(unsigned char* metaArr, K* keyArr, V* valArr, // Raw-array removal probe loop,
+	size_t* hashArr, size_t tableSize, size_t h, const LK& key, int* probeGroups) { // returns whether a slot was tombstoned
+	unsigned char fragment = metaFragment(h); // 7-bit fragment to scan for in the metadata array
+	size_t groups = tableSize / GROUP_SIZE; // Number of metadata groups to probe at most
+	for (size_t g = 0; g < groups; ++g) { // Walk the key's group sequence
+		size_t base = groupBaseFor(h, g, tableSize); // First slot of this metadata group
+		unsigned int candidates = matchMask(&metaArr[base], fragment); // Slots whose metadata byte matches the fragment
+		while (candidates != 0) { // Check each candidate slot
+			size_t index = base + lowestSetBit(candidates); // Slot index of the lowest remaining candidate
+			candidates &= candidates - 1; // Clear that candidate from the mask
+			if (hashArr[index] == h && keyArr[index] == key) { // Cached hash filters out mismatches before the key compare
+				metaArr[index] = META_DELETED; // Tombstone the slot so later probes continue past it
+				keyArr[index] = K(); // Drop the stored key so its resources are released
+				valArr[index] = V(); // Drop the stored value so its resources are released
+				if (probeGroups != nullptr) { *probeGroups = static_cast<int>(g) + 1; } // Report the probe length to an instrumented caller
+				return true; // A slot was tombstoned
+            }
+        }
+		if (matchMask(&metaArr[base], META_EMPTY) != 0) { // An empty byte ends the probe chain
+			if (probeGroups != nullptr) { *probeGroups = static_cast<int>(g) + 1; } // Report the probe length to an instrumented caller
+			return false;  // Key not found
+        }
+    }
+	if (probeGroups != nullptr) { *probeGroups = static_cast<int>(groups); } // Report the full-table scan to an instrumented caller
+	return false; // Key not found after probing the whole table
+}
+
+// This section is the removal probe loop, taking the key's hash as a parameter for the same
+// prefetch-ahead reason as findSlot(). As a mutating operation it pays a migration step first,
+// and a miss in the live table falls through to the old one while a migration is in flight.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename LK> // Lookup key type
+void HashTable<K, V, Hasher, Allocator>::removeSlot(size_t h, const LK& key) { // Removal probe loop implementation
+	if (migrating) { // A gradual migration is in flight
+		migrateStep(); // Pay this operation's bounded share of the migration
+    }
+	if (hotCacheEnabled && hotCache[hotIndex(h)].valid && hotCache[hotIndex(h)].hash == h) { // The front cache tracks this key
+		hotCache[hotIndex(h)].valid = false; // Drop the entry; the slot is about to be tombstoned
+    }
+#if defined(HASH_TABLE_STATS) // Instrumentation compiled in: measure the probe
+	int probeGroups = 0; // Groups this removal examined in the live table
+	bool removed = probeRemove(metaData(), keysData(), valuesData(), hashesData(), size, h, key, &probeGroups); // Probe the live table first
+	recordProbe(probeGroups); // Feed the histogram; the rare old-table fallback below is not re-counted
+	if (removed) { // A live-table slot was tombstoned
+#else // Instrumentation compiled out: the plain probe
+	if (probeRemove(metaData(), keysData(), valuesData(), hashesData(), size, h, key)) { // Probe the live table first
+#endif
+		count--; // Decrement count
+		tombstones++; // Track the tombstone for load-factor accounting and resize reclamation
+    }
+	else if (migrating && probeRemove(oldMeta.data(), oldKeys.data(), oldValues.data(), oldHashes.data(), oldSize, h, key)) { // The element may not have migrated yet
+		count--; // Decrement count; old-table tombstones just vanish with the migration
+    }
+}
+
+// This section inserts a whole batch of key-value pairs. The table is grown once up front so no
+// mid-batch resize invalidates prefetched slots, then the batch is processed in windows: hashes
+// for the next BATCH_WINDOW keys are computed and their target metadata groups prefetched before
+// any of them is probed, so the probe misses overlap instead of forming one dependent chain.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::insertBatch(const vector<K>& batchKeys, const vector<V>& batchValues) { // Batch insert implementation
+	size_t n = batchKeys.size(); // Number of pairs in the batch
+	finishMigration(); // The bulk path sidesteps per-operation migration: complete any in-flight one first
+	while (static_cast<double>(count + tombstones + n) / size > maxLoadFactor) { // Grow until the whole batch fits under the load factor
+		resize(); // Resize the hash table up front
+    }
+	size_t hashWindow[BATCH_WINDOW]; // Precomputed hashes for the operations in flight
+	for (size_t start = 0; start < n; start += BATCH_WINDOW) { // Process the batch window by window
+		size_t windowEnd = (start + BATCH_WINDOW < n) ? start + BATCH_WINDOW : n; // Last operation in this window
+		for (size_t j = start; j < windowEnd; ++j) { // First pass: hash and prefetch
+			hashWindow[j - start] = hashKey(batchKeys[j]); // Compute the hash up front
+			prefetchProbe(hashWindow[j - start]); // Start pulling the target group into cache
+        }
+		for (size_t j = start; j < windowEnd; ++j) { // Second pass: resolve the probes
+			placeSlot(hashWindow[j - start], batchKeys[j], batchValues[j]); // Insert with the precomputed hash
+        }
+    }
+}
+
+// This section builds the table from a whole range of key-value pairs with worker threads, the
+// bulk path for loading a table from a snapshot or an ETL run. The table is grown to its final
+// size up front (in parallel stripes when the grow is itself large enough), so no resize can
+// move slots mid-load; the input is then cut into one contiguous chunk per worker, and every
+// worker places its chunk with parallelPlace(), claiming slots through casMeta(). The chunks
+// need no relation to the hash space precisely because claims are atomic: any partition is safe,
+// and an even split keeps the workers load-balanced. The keys of the range must be distinct from
+// each other (duplicates race and may land twice); keys already resident in the table are
+// overwritten in place as usual. Small ranges fall back to the serial insert path, where thread
+// start-up would cost more than it hides.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+template <typename It> // Iterator over pair<K, V> items
+void HashTable<K, V, Hasher, Allocator>::bulkLoad(It first, It last, size_t nThreads) { // Parallel bulk-load implementation
+	size_t n = static_cast<size_t>(distance(first, last)); // Number of pairs in the range
+	finishMigration(); // The bulk path sidesteps per-operation migration: complete any in-flight one first
+	if (nThreads == 0) { // Zero means "pick for me"
+		nThreads = thread::hardware_concurrency(); // Default to one worker per hardware thread
+		if (nThreads == 0) { nThreads = 1; } // The runtime may not know the machine; fall back to serial
+    }
+	if (nThreads <= 1 || n < BULK_SERIAL_CUTOFF) { // Too small for the parallelism to pay off
+		for (It it = first; it != last; ++it) { // Walk the range serially
+			insertSlot(it->first, it->second); // The ordinary insert path handles growth and duplicates alike
+        }
+		return; // Nothing left to do
+    }
+	size_t needed = sizeForElements(count + n); // Final size the whole load fits under the load factor
+	if (needed > size) { // The table must grow before workers can rely on stable slots
+		rehashParallel(needed, nThreads); // One parallel rebuild instead of a doubling cascade; serial fallback for small tables
+    }
+	clearHotCache(); // Cached slot indices must not be promoted into while workers write slots
+	unsigned char* metaArr = metaData(); // Active metadata array; heap-backed, since the cutoff exceeds the inline block
+	K* keyArr = keysData(); // Active key array
+	V* valArr = valuesData(); // Active value array
+	size_t* hashArr = hashesData(); // Active hash cache
+	size_t tableSize = size; // Table size is stable for the whole load: capacity was reserved above
+	vector<size_t> placed(nThreads, 0); // Per-worker count of newly claimed slots, summed after the join
+	vector<size_t> reclaimed(nThreads, 0); // Per-worker count of reclaimed tombstones, summed after the join
+	vector<thread> workers; // The chunk workers
+	workers.reserve(nThreads); // One thread per chunk
+	size_t chunk = n / nThreads; // Pairs per worker before remainder spreading
+	size_t extra = n % nThreads; // Leftover pairs, given one each to the first workers
+	It cursor = first; // Start of the next chunk
+	for (size_t t = 0; t < nThreads; ++t) { // Launch one worker per chunk
+		size_t len = chunk + (t < extra ? 1 : 0); // This worker's share of the range
+		if (len == 0) { // More threads than pairs
+			break; // The remaining workers would have nothing to do
+        }
+		It chunkBegin = cursor; // First pair of this worker's chunk
+		advance(cursor, static_cast<typename iterator_traits<It>::difference_type>(len)); // Step the cursor past the chunk
+		It chunkEnd = cursor; // One past the last pair of the chunk
+		workers.emplace_back([=, &placed, &reclaimed]() { // Each worker places its chunk of the input
+			size_t claimed = 0; // New slots this worker claimed
+			size_t freedTombstones = 0; // Tombstones this worker reclaimed
+			for (It it = chunkBegin; it != chunkEnd; ++it) { // Walk the chunk
+				if (parallelPlace(metaArr, keyArr, valArr, hashArr, tableSize, // Claim a slot for the pair, or overwrite
+					hashKey(it->first), it->first, it->second, freedTombstones)) { // a resident key's value in place
+					claimed++; // Count the newly claimed slot
+                }
+            }
+			placed[t] = claimed; // Publish the worker's tallies for the join below
+			reclaimed[t] = freedTombstones; // Tombstone reclamations adjust the shared counter after the join
+        });
+    }
+	for (thread& worker : workers) { // Wait for every chunk to land
+		worker.join(); // Block until this worker finishes
+    }
+	for (size_t t = 0; t < nThreads; ++t) { // Fold the per-worker tallies into the table's counters
+		count += placed[t]; // Each newly claimed slot is one new element
+		tombstones -= reclaimed[t]; // Each reclaimed tombstone leaves the load-factor accounting
+    }
+}
+
+// This section looks up a whole batch of keys, writing a value pointer (or nullptr on a miss)
+// per key into the caller-provided results buffer, with the same hash-ahead/prefetch pipelining
+// as insertBatch(). This is the bulk path for scan jobs.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::retrieveBatch(const vector<K>& batchKeys, vector<const V*>& results) const { // Batch lookup implementation
+	size_t n = batchKeys.size(); // Number of keys in the batch
+	results.resize(n); // Size the output buffer to match the batch
+	size_t hashWindow[BATCH_WINDOW]; // Precomputed hashes for the operations in flight
+	for (size_t start = 0; start < n; start += BATCH_WINDOW) { // Process the batch window by window
+		size_t windowEnd = (start + BATCH_WINDOW < n) ? start + BATCH_WINDOW : n; // Last operation in this window
+		for (size_t j = start; j < windowEnd; ++j) { // First pass: hash and prefetch
+			hashWindow[j - start] = hashKey(batchKeys[j]); // Compute the hash up front
+			prefetchProbe(hashWindow[j - start]); // Start pulling the target group into cache
+        }
+		for (size_t j = start; j < windowEnd; ++j) { // Second pass: resolve the probes
+			results[j] = findSlot(hashWindow[j - start], batchKeys[j]); // Look up with the precomputed hash
+        }
+    }
+}
+
+// This section removes a whole batch of keys with the same pipelining as the other batch calls.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::removeBatch(const vector<K>& batchKeys) { // Batch remove implementation
+	size_t n = batchKeys.size(); // Number of keys in the batch
+	size_t hashWindow[BATCH_WINDOW]; // Precomputed hashes for the operations in flight
+	for (size_t start = 0; start < n; start += BATCH_WINDOW) { // Process the batch window by window
+		size_t windowEnd = (start + BATCH_WINDOW < n) ? start + BATCH_WINDOW : n; // Last operation in this window
+		for (size_t j = start; j < windowEnd; ++j) { // First pass: hash and prefetch
+			hashWindow[j - start] = hashKey(batchKeys[j]); // Compute the hash up front
+			prefetchProbe(hashWindow[j - start]); // Start pulling the target group into cache
+        }
+		for (size_t j = start; j < windowEnd; ++j) { // Second pass: resolve the probes
+			removeSlot(hashWindow[j - start], batchKeys[j]); // Remove with the precomputed hash
+        }
+    }
+}
+
+// This section displays all occupied slots in the hash table, including their keys and values.
+// It writes to a caller-provided stream so the header no longer needs <iostream> and the data
+// path never touches the console.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::print(ostream& out) const { // Print method implementation
+	for (size_t i = nextOccupied(metaData(), size, 0); i < size; i = nextOccupied(metaData(), size, i + 1)) { // Jump occupied-to-occupied, a group at a time
+		out << "Index " << i << ": Key = " << keysData()[i] // Output key-value pair
+			<< ", Value = " << valuesData()[i] << endl; // Output key-value pair
+    }
+	out << "Size: " << size << ", Count: " << count << ", Tombstones: " << tombstones << endl; // Output size, count, and tombstones
+}
+
+// This section resets the hash table to an empty state, maintaining its current size. The reset
+// happens in place: occupied slots have their keys and values dropped and every metadata byte
+// is marked empty, with no reallocation, so clearing a per-request table between uses is cheap.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::clear() { // Clear method implementation
+	clearHotCache(); // No cached probe result survives a reset
+	unsigned char* metaArr = metaData(); // Active metadata array, inline or heap
+	K* keyArr = keysData(); // Active key array
+	V* valArr = valuesData(); // Active value array
+	for (size_t i = nextOccupied(metaArr, size, 0); i < size; i = nextOccupied(metaArr, size, i + 1)) { // Jump occupied-to-occupied, a group at a time
+		keyArr[i] = K(); // Drop the stored key so its resources are released
+		valArr[i] = V(); // Drop the stored value so its resources are released
+    }
+	fill(metaArr, metaArr + size, META_EMPTY); // Mark every slot empty in place; tombstoned slots were already dropped
 	count = 0; // Reset count to 0
+	tombstones = 0; // Reset tombstones to 0
+	oldMeta = vector<unsigned char, MetaAllocator>(MetaAllocator(alloc)); // Release any old metadata array: cleared tables have nothing to migrate
+	oldKeys = vector<K, KeyAllocator>(KeyAllocator(alloc)); // Release any old key array
+	oldValues = vector<V, ValueAllocator>(ValueAllocator(alloc)); // Release any old value array
+	oldHashes = vector<size_t, HashAllocator>(HashAllocator(alloc)); // Release any old hash cache
+	oldSize = 0; // No old table any more
+	migratePos = 0; // Reset the migration cursor
+	migrating = false; // Any in-flight migration is abandoned along with its elements
+}
+
+// This section writes the table to a stream as a versioned binary image: a fixed header followed
+// by the four slot arrays byte for byte, cached hashes included. Reloading the image is four bulk
+// reads with no hashing and no probing, replacing the insert-in-a-loop rebuild at process start.
+// The raw-byte dump restricts the format to trivially copyable key and value types, enforced at
+// compile time, and the header pins the type sizes so an image cannot be loaded into a
+// differently-shaped table.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::serialize(ostream& out) { // Serialize method implementation
+	static_assert(is_trivially_copyable<K>::value && is_trivially_copyable<V>::value, "serialize requires trivially copyable key and value types"); // The arrays are dumped as raw bytes
+	finishMigration(); // The image describes one table, never a table mid-migration
+	unsigned int header[6] = { SERIAL_MAGIC, SERIAL_VERSION, // Magic and format version identify the image
+		static_cast<unsigned int>(sizeof(K)), static_cast<unsigned int>(sizeof(V)), static_cast<unsigned int>(sizeof(size_t)), // Type sizes pin the layout
+		0 }; // Reserved padding word keeping every image section 8-byte aligned
+	out.write(reinterpret_cast<const char*>(header), sizeof(header)); // Write the fixed header
+	out.write(reinterpret_cast<const char*>(&size), sizeof(size)); // Write the table size
+	out.write(reinterpret_cast<const char*>(&count), sizeof(count)); // Write the element count
+	out.write(reinterpret_cast<const char*>(&tombstones), sizeof(tombstones)); // Write the tombstone count
+	out.write(reinterpret_cast<const char*>(&maxLoadFactor), sizeof(maxLoadFactor)); // Write the load-factor threshold
+	out.write(reinterpret_cast<const char*>(metaData()), static_cast<streamsize>(size)); // Dump the metadata bytes
+	out.write(reinterpret_cast<const char*>(keysData()), static_cast<streamsize>(size) * sizeof(K)); // Dump the key array
+	out.write(reinterpret_cast<const char*>(valuesData()), static_cast<streamsize>(size) * sizeof(V)); // Dump the value array
+	out.write(reinterpret_cast<const char*>(hashesData()), static_cast<streamsize>(size) * sizeof(size_t)); // Dump the hash cache
+	if (!out) { // The stream rejected part of the image
+		throw runtime_error("Failed to write hash table image"); // Surface the I/O failure
+    }
+}
+
+// This section reloads a binary image written by serialize(), replacing the table's contents.
+// The header is validated before anything is overwritten, so a mismatched or corrupt image
+// throws and leaves the table untouched.
+template <typename K, typename V, typename Hasher, typename Allocator> // Template for key, value, hash policy, and allocator types
+void HashTable<K, V, Hasher, Allocator>::deserialize(istream& in) { // Deserialize method implementation
+	static_assert(is_trivially_copyable<K>::value && is_trivially_copyable<V>::value, "deserialize requires trivially copyable key and value types"); // The arrays are read as raw bytes
+	clearHotCache(); // Cached slot indices are meaningless against the incoming image
+	unsigned int header[6]; // Magic, version, type sizes, and the alignment padding word from the image
+	in.read(reinterpret_cast<char*>(header), sizeof(header)); // Read the fixed header
+	if (!in || header[0] != SERIAL_MAGIC) { // Not a hash table image
+		throw runtime_error("Not a hash table image"); // Reject before touching the table
+    }
+	if (header[1] != SERIAL_VERSION) { // Image written by a different format version
+		throw runtime_error("Unsupported hash table image version"); // Reject before touching the table
+    }
+	if (header[2] != sizeof(K) || header[3] != sizeof(V) || header[4] != sizeof(size_t)) { // Image written for differently-sized types
+		throw runtime_error("Hash table image type sizes do not match"); // Reject before touching the table
+    }
+	size_t newSize = 0; // Table size from the image
+	size_t newCount = 0; // Element count from the image
+	size_t newTombstones = 0; // Tombstone count from the image
+	double newLoadFactor = 0.0; // Load-factor threshold from the image
+	in.read(reinterpret_cast<char*>(&newSize), sizeof(newSize)); // Read the table size
+	in.read(reinterpret_cast<char*>(&newCount), sizeof(newCount)); // Read the element count
+	in.read(reinterpret_cast<char*>(&newTombstones), sizeof(newTombstones)); // Read the tombstone count
+	in.read(reinterpret_cast<char*>(&newLoadFactor), sizeof(newLoadFactor)); // Read the load-factor threshold
+	if (!in || newSize < static_cast<size_t>(GROUP_SIZE) || newSize != roundUpToPowerOfTwo(newSize)) { // Sizes must preserve the power-of-two invariant
+		throw runtime_error("Corrupt hash table image header"); // Reject before touching the table
+    }
+	finishMigration(); // The reloaded table replaces any in-flight migration
+	size = newSize; // Adopt the image's size
+	count = newCount; // Adopt the image's element count
+	tombstones = newTombstones; // Adopt the image's tombstone count
+	maxLoadFactor = newLoadFactor; // Adopt the image's load-factor threshold
+	inlineStorage = INLINE_CAPABLE && size <= INLINE_SLOTS; // An image of a small table reloads into the inline block
+	if (inlineStorage) { // The image fits inside the object
+		meta = vector<unsigned char, MetaAllocator>(MetaAllocator(alloc)); // Release any heap metadata array
+		keys = vector<K, KeyAllocator>(KeyAllocator(alloc)); // Release any heap key array
+		values = vector<V, ValueAllocator>(ValueAllocator(alloc)); // Release any heap value array
+		hashes = vector<size_t, HashAllocator>(HashAllocator(alloc)); // Release any heap hash cache
+    }
+	else { // The image is too large for the inline block
+		meta = vector<unsigned char, MetaAllocator>(size, META_EMPTY, MetaAllocator(alloc)); // Size the metadata array for the image
+		keys = vector<K, KeyAllocator>(size, KeyAllocator(alloc)); // Size the key array for the image
+		values = vector<V, ValueAllocator>(size, ValueAllocator(alloc)); // Size the value array for the image
+		hashes = vector<size_t, HashAllocator>(size, HashAllocator(alloc)); // Size the hash cache for the image
+    }
+	in.read(reinterpret_cast<char*>(metaData()), static_cast<streamsize>(size)); // Bulk-read the metadata bytes
+	in.read(reinterpret_cast<char*>(keysData()), static_cast<streamsize>(size) * sizeof(K)); // Bulk-read the key array
+	in.read(reinterpret_cast<char*>(valuesData()), static_cast<streamsize>(size) * sizeof(V)); // Bulk-read the value array
+	in.read(reinterpret_cast<char*>(hashesData()), static_cast<streamsize>(size) * sizeof(size_t)); // Bulk-read the hash cache
+	if (!in) { // The image ended before the arrays did
+		throw runtime_error("Truncated hash table image"); // The table now holds partial data; callers should discard it
+    }
 }
 
 #endif // End of include guard for HASH_TABLE_H
\ No newline at end of file
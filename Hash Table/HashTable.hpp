@@ -1,38 +1,193 @@
-// HashTable.hpp
+/*
+This file implements a templated ChainedHashTable class: separate chaining over a node pool, as
+the alternative engine to HashTable's open addressing. Every node lives in one contiguous pool
+indexed by integer, chains are linked through pool indices rather than pointers, and freed nodes
+go on an intrusive free list for reuse, so there is no per-node heap allocation and no pointer
+chasing across arbitrary heap addresses. Deletion unlinks a node outright - no tombstones, no
+backward shifting - which is exactly what high-churn delete-heavy workloads want. The class
+exposes the same core interface as HashTable itself, so the two engines can be A/B swapped per
+workload. (This file previously held an out-of-line chaining implementation for a long-gone
+std::list-based HashTable; it is now a self-contained class.)
+*/
 
-#include "HashTable.h"
+#ifndef HASH_TABLE_HPP // Include guard to prevent duplicate definitions
+#define HASH_TABLE_HPP // This line defines the header file if it has not been defined before
 
-template <typename K, typename V>
-void HashTable<K, V>::insert(const K& key, const V& value) {
-    int index = hash(key);
-    for (auto& pair : table[index]) {
-        if (pair.first == key) {
-            pair.second = value;
-            return;
+#include <vector> // Include vector for the bucket array and node pool
+#include <stdexcept> // Include stdexcept for runtime_error
+#include <functional> // Include functional for hash
+#include <utility> // Include utility for move and forward
+#include <ostream> // Include ostream for the print() debugging helper
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section initializes the chained table with a given bucket count or default. Buckets hold
+// the pool index of their first node (-1 for an empty bucket); each node holds the index of the
+// next node in its chain. Because chains are index-linked, growing the bucket array only relinks
+// indices - nodes never move, so keys and values are never copied by a rehash.
+template <typename K, typename V, typename Hasher = hash<K>> // Template for key, value, and hash policy types
+class ChainedHashTable { // ChainedHashTable class definition
+private: // Private section for internal data and helper methods
+	static constexpr int DEFAULT_SIZE = 16; // Default bucket count, always a power of two
+	static constexpr int NIL = -1; // Index value marking an empty bucket or the end of a chain
+
+	struct Node { // One element of the table, living in the pool
+		K key; // The node's key
+		V value; // The node's value
+		size_t hash; // Cached full hash, so rehash and probes never re-hash the key
+		int next; // Pool index of the next node in the chain, NIL at the end
+    };
+
+	int size; // Current bucket count, always a power of two
+	int count; // Number of elements in the hash table
+	double maxLoadFactor; // Elements-per-bucket threshold that triggers bucket doubling
+	vector<int> buckets; // Pool index of each bucket's first node, NIL for empty
+	vector<Node> pool; // The node pool every element lives in, contiguous
+	int freeHead; // Head of the intrusive free list of recycled pool slots, NIL when empty
+	Hasher hasher; // The table's hash policy instance, default-constructed
+
+	static int roundUpToPowerOfTwo(int s) { // Round a requested bucket count up to the next power of two
+		int p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested count
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+	int bucketIndex(size_t h) const { // The bucket a hash falls into
+		return static_cast<int>(h & static_cast<size_t>(size - 1)); // Bitmask index over the power-of-two bucket count
+    }
+
+	int allocateNode() { // Take a pool slot for a new node, recycling freed slots first
+		if (freeHead != NIL) { // The free list has a recycled slot
+			int index = freeHead; // Reuse its slot
+			freeHead = pool[index].next; // Pop it off the free list
+			return index; // Return the recycled slot
         }
+		pool.push_back(Node()); // No recycled slot: grow the pool by one node
+		return static_cast<int>(pool.size()) - 1; // Return the new slot
+    }
+
+	void freeNode(int index) { // Return a pool slot to the free list
+		pool[index].key = K(); // Drop the stored key so its resources are released
+		pool[index].value = V(); // Drop the stored value so its resources are released
+		pool[index].next = freeHead; // Chain the slot onto the free list
+		freeHead = index; // It is the new free-list head
     }
-    table[index].push_back(std::make_pair(key, value));
-}
 
-template <typename K, typename V>
-V HashTable<K, V>::retrieve(const K& key) const {
-    int index = hash(key);
-    for (const auto& pair : table[index]) {
-        if (pair.first == key) {
-            return pair.second;
+	// Double the bucket array and relink every node into its new bucket. Nodes stay where they
+	// are in the pool: a rehash here moves integers, never keys or values.
+	void rehashBuckets() { // Bucket-doubling rehash implementation
+		size *= 2; // Double the bucket count, preserving the power-of-two invariant
+		buckets = vector<int>(size, NIL); // Create the new bucket array, all empty
+		vector<bool> inPool(pool.size(), true); // Marks pool slots holding live nodes
+		for (int f = freeHead; f != NIL; f = pool[f].next) { // Walk the free list
+			inPool[f] = false; // Free slots hold no element to relink
+        }
+		for (int i = 0; i < static_cast<int>(pool.size()); ++i) { // Walk the whole pool
+			if (inPool[i]) { // If the slot holds a live node
+				int bucket = bucketIndex(pool[i].hash); // Its new bucket, from the cached hash
+				pool[i].next = buckets[bucket]; // Link it in front of the bucket's chain
+				buckets[bucket] = i; // It is the new chain head
+            }
         }
     }
-    throw std::runtime_error("Key not found");
-}
 
-template <typename K, typename V>
-void HashTable<K, V>::remove(const K& key) {
-    int index = hash(key);
-    auto& list = table[index];
-    for (auto it = list.begin(); it != list.end(); ++it) {
-        if (it->first == key) {
-            list.erase(it);
-            return;
+	template <typename KT, typename VT> // Forwarding reference types for key and value
+	void insertSlot(KT&& key, VT&& value) { // Insert implementation shared by both insert() flavors
+		size_t h = hasher(key); // Hash the key exactly once
+		int bucket = bucketIndex(h); // The chain this key belongs to
+		for (int i = buckets[bucket]; i != NIL; i = pool[i].next) { // Walk the chain
+			if (pool[i].hash == h && pool[i].key == key) { // Cached hash filters out mismatches before the key compare
+				pool[i].value = forward<VT>(value); // Key already present: overwrite the value in place
+				return; // Exit loop
+            }
+        }
+		if (static_cast<double>(count + 1) / size > maxLoadFactor) { // Check elements per bucket before linking the new node
+			rehashBuckets(); // Double the buckets; nodes are relinked, not moved
+			bucket = bucketIndex(h); // The key's bucket may have changed
         }
+		int index = allocateNode(); // Take a pool slot for the new node
+		pool[index].key = forward<KT>(key); // Forward key into the node (moves for rvalues)
+		pool[index].value = forward<VT>(value); // Forward value into the node (moves for rvalues)
+		pool[index].hash = h; // Cache the full hash for rehash and later probes
+		pool[index].next = buckets[bucket]; // Link the node in front of its chain
+		buckets[bucket] = index; // It is the new chain head
+		count++; // Increment count
     }
-}
\ No newline at end of file
+
+// This section defines the public interface, mirroring HashTable's core so the two engines can
+// be swapped per workload.
+public: // Public section for external interface methods
+	ChainedHashTable(int s = DEFAULT_SIZE, double loadFactor = 1.0) // Constructor taking an initial bucket count and load-factor threshold
+		: size(roundUpToPowerOfTwo(s < DEFAULT_SIZE ? DEFAULT_SIZE : s)), count(0), // Round the requested count up to a power of two
+		maxLoadFactor(loadFactor), // Chains tolerate a load factor of one element per bucket by default
+		buckets(size, NIL), freeHead(NIL) { // Start with every bucket empty and nothing on the free list
+    }
+
+	void insert(const K& key, const V& value) { insertSlot(key, value); } // Method to insert key-value pair by copy
+	void insert(K&& key, V&& value) { insertSlot(move(key), move(value)); } // Method to insert key-value pair by move
+
+	V retrieve(const K& key) const { // Method to retrieve value for key, throws if not found
+		const V* value = find(key); // Probe for the key without throwing
+		if (value == nullptr) { // If key was not found
+			throw runtime_error("Key not found"); // Throw exception if key is not found
+        }
+		return *value; // Return a copy of the value
+    }
+
+	const V* find(const K& key) const { // Const method to find value for key, returns nullptr if not found
+		size_t h = hasher(key); // Hash the key exactly once
+		for (int i = buckets[bucketIndex(h)]; i != NIL; i = pool[i].next) { // Walk the chain
+			if (pool[i].hash == h && pool[i].key == key) { // Cached hash filters out mismatches before the key compare
+				return &pool[i].value; // Return pointer to value
+            }
+        }
+		return nullptr; // Key not found at the end of the chain
+    }
+
+	V* find(const K& key) { // Method to find value for key, returns nullptr if not found
+		return const_cast<V*>(static_cast<const ChainedHashTable*>(this)->find(key)); // Reuse the const probe loop
+    }
+
+	void remove(const K& key) { // Method to remove key-value pair by unlinking its node
+		size_t h = hasher(key); // Hash the key exactly once
+		int bucket = bucketIndex(h); // The chain this key belongs to
+		int prev = NIL; // The node before the current one, NIL at the chain head
+		for (int i = buckets[bucket]; i != NIL; prev = i, i = pool[i].next) { // Walk the chain remembering the predecessor
+			if (pool[i].hash == h && pool[i].key == key) { // Cached hash filters out mismatches before the key compare
+				if (prev == NIL) { // The node is the chain head
+					buckets[bucket] = pool[i].next; // The bucket now starts at its successor
+                }
+				else { // The node is mid-chain
+					pool[prev].next = pool[i].next; // Unlink it from its predecessor
+                }
+				freeNode(i); // Recycle the pool slot; no tombstone, no shifting
+				count--; // Decrement count
+				return; // Exit loop
+            }
+        }
+    }
+
+	int getSize() const { return size; } // Getter method for the bucket count
+	int getCount() const { return count; } // Getter method for count
+
+	void print(ostream& out) const { // Method to print the contents of the hash table to a caller-provided stream
+		for (int b = 0; b < size; ++b) { // Iterate over buckets
+			for (int i = buckets[b]; i != NIL; i = pool[i].next) { // Walk each chain
+				out << "Bucket " << b << ": Key = " << pool[i].key // Output key-value pair
+					<< ", Value = " << pool[i].value << endl; // Output key-value pair
+            }
+        }
+		out << "Buckets: " << size << ", Count: " << count << endl; // Output bucket count and element count
+    }
+
+	void clear() { // Method to clear the hash table
+		buckets = vector<int>(size, NIL); // Create new bucket array with same size, all empty
+		pool = vector<Node>(); // Release the whole node pool at once
+		freeHead = NIL; // Nothing on the free list
+		count = 0; // Reset count to 0
+    }
+};
+
+#endif // End of include guard for HASH_TABLE_HPP
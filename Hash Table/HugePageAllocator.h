@@ -0,0 +1,93 @@
+/*
+This file implements a huge-page-friendly allocator for very large HashTable instances. A table
+spanning hundreds of gigabytes touches its slot arrays at random, so with 4KB pages the TLB
+thrashes long before memory bandwidth is the limit. HugePageAllocator<T> hands big allocations
+out on 2MB boundaries and asks the operating system to back them with huge pages (transparent
+huge pages via madvise on Linux, large pages via VirtualAlloc on Windows, with graceful fallback
+to normal pages when the system refuses), cutting TLB misses on the probe path by roughly the
+page-size ratio. Small allocations fall through to the global allocator untouched, so the same
+allocator type serves a table across its whole growth curve.
+*/
+
+#ifndef HUGE_PAGE_ALLOCATOR_H // Include guard to prevent duplicate definitions
+#define HUGE_PAGE_ALLOCATOR_H // This line defines the header file if it has not been defined before
+
+#include <cstddef> // Include cstddef for size_t
+#include <new> // Include new for bad_alloc and the small-allocation fallback
+
+#if defined(_WIN32) // Windows large-page primitives
+#define NOMINMAX // Keep windows.h from defining min/max macros
+#include <windows.h> // Include VirtualAlloc and VirtualFree
+#else // POSIX huge-page primitives
+#include <sys/mman.h> // Include mmap, munmap, and madvise
+#endif
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the allocator handle that HashTable's Allocator parameter accepts. The
+// handle is stateless: whether an allocation took the huge-page path is recomputed from its size
+// in deallocate(), so all rebound copies are interchangeable.
+template <typename T> // Element type this handle allocates
+class HugePageAllocator { // HugePageAllocator class definition
+private: // Private section for internal constants
+	static const size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024; // The common 2MB huge-page size; also the threshold below which the global allocator is used
+
+	static size_t roundUpToHugePage(size_t bytes) { // Round a byte count up to a whole number of huge pages
+		return (bytes + HUGE_PAGE_BYTES - 1) & ~(HUGE_PAGE_BYTES - 1); // Align so the kernel can back the whole block with huge pages
+    }
+
+public: // Public section for the allocator interface
+	using value_type = T; // Element type, as the allocator protocol requires
+
+	HugePageAllocator() = default; // The handle is stateless, so default construction suffices
+
+	template <typename U> // Element type of the handle being copied
+	HugePageAllocator(const HugePageAllocator<U>&) {} // Rebinding copy carries no state
+
+	T* allocate(size_t n) { // Allocate storage for n elements
+		size_t bytes = n * sizeof(T); // Bytes requested
+		if (bytes < HUGE_PAGE_BYTES) { // Small allocations gain nothing from huge pages
+			return static_cast<T*>(::operator new(bytes)); // Fall through to the global allocator
+        }
+		size_t mapped = roundUpToHugePage(bytes); // Map whole huge pages so the block can be fully backed
+#if defined(_WIN32) // Windows large-page path
+		void* block = VirtualAlloc(nullptr, mapped, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE); // Ask for large pages outright
+		if (block == nullptr) { // Large pages need a privilege the process may not hold
+			block = VirtualAlloc(nullptr, mapped, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE); // Fall back to normal pages at the same alignment
+        }
+		if (block == nullptr) { // The reservation failed outright
+			throw bad_alloc(); // Surface the allocation failure
+        }
+#else // POSIX huge-page path
+		void* block = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); // Reserve an anonymous mapping on a page boundary
+		if (block == MAP_FAILED) { // The reservation failed outright
+			throw bad_alloc(); // Surface the allocation failure
+        }
+#if defined(MADV_HUGEPAGE) // Transparent huge pages are advisory
+		madvise(block, mapped, MADV_HUGEPAGE); // Ask the kernel to back the block with huge pages; a refusal just means normal pages
+#endif
+#endif
+		return static_cast<T*>(block); // Return the huge-page-aligned block
+    }
+
+	void deallocate(T* p, size_t n) { // Release storage for n elements
+		size_t bytes = n * sizeof(T); // Recompute the size-based path taken at allocation
+		if (bytes < HUGE_PAGE_BYTES) { // The allocation came from the global allocator
+			::operator delete(p); // Release it the same way
+			return; // Nothing mapped to release
+        }
+#if defined(_WIN32) // Windows teardown
+		VirtualFree(p, 0, MEM_RELEASE); // Release the whole reservation
+#else // POSIX teardown
+		munmap(p, roundUpToHugePage(bytes)); // Unmap the same whole-page length that was mapped
+#endif
+    }
+
+	template <typename U> // Element type of the handle being compared
+	bool operator==(const HugePageAllocator<U>&) const { return true; } // Stateless handles are always equal
+
+	template <typename U> // Element type of the handle being compared
+	bool operator!=(const HugePageAllocator<U>&) const { return false; } // Inequality is the negation
+};
+
+#endif // End of include guard for HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,113 @@
+/*
+This file implements a templated LockFreeHashTable class for insert/lookup workloads on the hot
+read path. Capacity is fixed at construction (there is no resize), slots are claimed with an
+atomic compare-and-swap on a per-slot state byte and published with a release store, and readers
+use plain atomic loads with acquire semantics. No locks are taken anywhere, so lookups cost a
+probe and nothing else. There is deliberately no remove() and no in-place overwrite: both would
+require coordination that this variant exists to avoid; use HashTable or ConcurrentHashTable for
+mutation-heavy workloads.
+*/
+
+#ifndef LOCK_FREE_HASH_TABLE_H // Include guard to prevent duplicate definitions
+#define LOCK_FREE_HASH_TABLE_H // This line defines the header file if it has not been defined before
+
+#include <atomic> // Include atomic for the slot state machine and counters
+#include <vector> // Include vector for the slot arrays
+#include <functional> // Include functional for hash
+#include <utility> // Include utility for move
+#include "HashTable.h" // Include HashTable for the shared hash policy types
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the fixed-capacity table. Each slot moves through a tiny state machine:
+// EMPTY -> CLAIMED (one writer wins the CAS) -> FULL (key, value, and hash are visible). Readers
+// that observe FULL with an acquire load are guaranteed to see the completed key and value.
+template <typename K, typename V, typename Hasher = hash<K>> // Template for key, value, and hash policy types
+class LockFreeHashTable { // LockFreeHashTable class definition
+private: // Private section for internal data and helper methods
+	static const unsigned char SLOT_EMPTY = 0; // Slot has never been claimed
+	static const unsigned char SLOT_CLAIMED = 1; // A writer won the CAS and is publishing the slot
+	static const unsigned char SLOT_FULL = 2; // Slot is published and immutable from here on
+
+	vector<atomic<unsigned char>> states; // Per-slot state machine, the only contended bytes
+	vector<size_t> hashes; // Full hash per slot, written before the FULL store publishes it
+	vector<K> keys; // Keys, written only by the slot's claiming writer
+	vector<V> values; // Values, written only by the slot's claiming writer
+	atomic<int> count; // Number of published elements
+	int capacity; // Slot count, fixed at construction and always a power of two
+	Hasher hasher; // The table's hash policy instance, default-constructed
+
+	static int roundUpToPowerOfTwo(int s) { // Round a requested capacity up to the next power of two
+		int p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested capacity
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+	int probeIndex(size_t h, int i) const { // Linear probing over the power-of-two capacity
+		return static_cast<int>((h + static_cast<size_t>(i)) & static_cast<size_t>(capacity - 1)); // Bitmask index
+    }
+
+// This section defines the public interface: insert and lookup only, both lock-free.
+public: // Public section for external interface methods
+	LockFreeHashTable(int cap) // Constructor taking the fixed capacity
+		: states(roundUpToPowerOfTwo(cap)), hashes(roundUpToPowerOfTwo(cap)), // Size the state and hash arrays
+		keys(roundUpToPowerOfTwo(cap)), values(roundUpToPowerOfTwo(cap)), // Size the key and value arrays
+		count(0), capacity(roundUpToPowerOfTwo(cap)) { // Start empty at the rounded capacity
+    }
+
+	// Insert a key-value pair. Returns true if this call published the pair, false if the key
+	// was already present or the table is full. Values are never overwritten after publication,
+	// which is what lets readers go lock-free.
+	bool insert(const K& key, const V& value) { // Lock-free insert implementation
+		size_t h = hasher(key); // Hash the key exactly once
+		for (int i = 0; i < capacity; ++i) { // Probe at most every slot
+			int index = probeIndex(h, i); // Calculate the probe index
+			unsigned char s = states[index].load(memory_order_acquire); // Observe the slot state
+			if (s == SLOT_EMPTY) { // The chain may end here: try to claim the slot
+				if (states[index].compare_exchange_strong(s, SLOT_CLAIMED, memory_order_acq_rel)) { // One writer wins the claim
+					keys[index] = key; // Write the key while the slot is exclusively ours
+					values[index] = value; // Write the value while the slot is exclusively ours
+					hashes[index] = h; // Write the hash while the slot is exclusively ours
+					states[index].store(SLOT_FULL, memory_order_release); // Publish: everything above is now visible to acquire readers
+					count.fetch_add(1, memory_order_relaxed); // Count the published element
+					return true; // Insert succeeded
+                }
+				// The CAS failed: s now holds the state another writer installed, handled below
+            }
+			while (s == SLOT_CLAIMED) { // Another writer is publishing this slot
+				s = states[index].load(memory_order_acquire); // Spin until it becomes FULL; publication is a handful of stores
+            }
+			if (s == SLOT_FULL && hashes[index] == h && keys[index] == key) { // The slot holds this key already
+				return false; // Duplicate insert: first writer wins
+            }
+        }
+		return false; // Every slot is claimed: the fixed-capacity table is full
+    }
+
+	// Look up a key. Returns a pointer to the published value or nullptr. Published slots are
+	// immutable, so the pointer stays valid for the table's lifetime with no lock held.
+	const V* find(const K& key) const { // Lock-free lookup implementation
+		size_t h = hasher(key); // Hash the key exactly once
+		for (int i = 0; i < capacity; ++i) { // Probe at most every slot
+			int index = probeIndex(h, i); // Calculate the probe index
+			unsigned char s = states[index].load(memory_order_acquire); // Observe the slot state
+			if (s == SLOT_EMPTY) { // The probe chain ends at an unclaimed slot
+				return nullptr; // Key not found
+            }
+			if (s == SLOT_FULL && hashes[index] == h && keys[index] == key) { // Published slot holding this key
+				return &values[index]; // The acquire load ordered these reads after publication
+            }
+			// CLAIMED slots are skipped: the element being published there is not yet visible
+        }
+		return nullptr; // Key not found after probing the whole table
+    }
+
+	bool contains(const K& key) const { return find(key) != nullptr; } // Whether a key is published
+
+	int getCount() const { return count.load(memory_order_relaxed); } // Getter method for the published element count
+	int getCapacity() const { return capacity; } // Getter method for the fixed capacity
+};
+
+#endif // End of include guard for LOCK_FREE_HASH_TABLE_H
@@ -0,0 +1,200 @@
+/*
+This file implements MappedHashTableView, a read-only view of a HashTable image produced by
+serialize(). Instead of reading the image into heap arrays, the file is memory-mapped and the
+slot-array pointers are aimed directly into the mapping, so opening a multi-gigabyte table costs
+a map call and a header check rather than a rebuild, pages are faulted in lazily as probes touch
+them, and every process mapping the same file shares one copy of the pages. Lookups reuse the
+exact probe loop the owning HashTable uses, so a view answers queries identically to the table
+that wrote the image.
+*/
+
+#ifndef MAPPED_HASH_TABLE_H // Include guard to prevent duplicate definitions
+#define MAPPED_HASH_TABLE_H // This line defines the header file if it has not been defined before
+
+#include <string> // Include string for the file path
+#include <stdexcept> // Include stdexcept for runtime_error
+#include <type_traits> // Include type_traits for the layout checks
+#include "HashTable.h" // Include HashTable for the shared probe loop and image format constants
+
+#if defined(_WIN32) // Windows mapping primitives
+#define NOMINMAX // Keep windows.h from defining min/max macros
+#include <windows.h> // Include CreateFileMapping and MapViewOfFile
+#else // POSIX mapping primitives
+#include <fcntl.h> // Include open
+#include <sys/mman.h> // Include mmap and munmap
+#include <sys/stat.h> // Include fstat for the file size
+#include <unistd.h> // Include close
+#endif
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the read-only view. The template parameters must match the table that
+// wrote the image: the image pins sizeof(K)/sizeof(V) but cannot pin the types or hash policy
+// themselves, so opening an image with the wrong instantiation is the caller's bug to avoid.
+template <typename K, typename V, typename Hasher = hash<K>> // Template for key, value, and hash policy types
+class MappedHashTableView { // MappedHashTableView class definition
+private: // Private section for internal data and helper methods
+	using Table = HashTable<K, V, Hasher>; // The table type whose image format and probe loop this view shares
+
+	static_assert(is_trivially_copyable<K>::value && is_trivially_copyable<V>::value, "MappedHashTableView requires trivially copyable key and value types"); // Mapped bytes are read in place
+	static_assert(alignof(K) <= 8 && alignof(V) <= 8, "MappedHashTableView requires key and value alignment of at most 8"); // Image sections are 8-byte aligned
+
+	const unsigned char* mapping; // Base of the mapped image, null until the map succeeds
+	size_t mappingBytes; // Total bytes mapped, needed to unmap on POSIX
+#if defined(_WIN32) // Windows keeps two handles alive for the mapping's lifetime
+	HANDLE file; // The open file handle
+	HANDLE section; // The file-mapping object
+#else // POSIX needs no state beyond the mapping itself
+#endif
+
+	const unsigned char* meta; // Metadata bytes, pointing into the mapping
+	const K* keys; // Key array, pointing into the mapping
+	const V* values; // Value array, pointing into the mapping
+	const size_t* hashes; // Hash cache, pointing into the mapping
+	size_t size; // Table size from the image header
+	size_t count; // Element count from the image header
+	Hasher hasher; // The view's hash policy instance, default-constructed
+
+	// Compute the full hash of a lookup key with the same transparent dispatch HashTable uses,
+	// so a view probes with byte-identical hashes to the table that wrote the image. As there,
+	// the hash<string> special case comes first so const char* probes hash through
+	// hash<string_view> instead of allocating a temporary string.
+	template <typename LK> // Lookup key type, convertible to or comparable with K
+	size_t hashKey(const LK& key) const { // Transparent hash dispatch
+		if constexpr (is_same_v<Hasher, hash<string>> && !is_same_v<LK, string> && is_convertible_v<const LK&, string_view>) { // Default-hashed string image probed with string-like text
+			return hash<string_view>{}(string_view(key)); // Hash the characters without allocating
+        }
+		else if constexpr (is_invocable_v<const Hasher&, const LK&>) { // Hasher understands this key type directly
+			return hasher(key); // Hash through the view's policy
+        }
+		else { // The policy cannot hash this probe type consistently
+			static_assert(is_invocable_v<const Hasher&, const LK&>, "Hasher cannot hash this lookup key type; use a transparent hash policy"); // Fail loudly at compile time
+			return 0; // Unreachable, keeps the compiler quiet
+        }
+    }
+
+	void attach(const unsigned char* base, size_t bytes) { // Validate the image header and aim the array pointers into the mapping
+		size_t headerBytes = 6 * sizeof(unsigned int) + 3 * sizeof(size_t) + sizeof(double); // Fixed header written by serialize(), including its alignment padding word
+		if (bytes < headerBytes) { // The file cannot even hold a header
+			throw runtime_error("Not a hash table image"); // Reject before reading fields
+        }
+		const unsigned int* header = reinterpret_cast<const unsigned int*>(base); // Magic, version, and type sizes
+		if (header[0] != Table::SERIAL_MAGIC) { // Not a hash table image
+			throw runtime_error("Not a hash table image"); // Reject the mapping
+        }
+		if (header[1] != Table::SERIAL_VERSION) { // Image written by a different format version
+			throw runtime_error("Unsupported hash table image version"); // Reject the mapping
+        }
+		if (header[2] != sizeof(K) || header[3] != sizeof(V) || header[4] != sizeof(size_t)) { // Image written for differently-sized types
+			throw runtime_error("Hash table image type sizes do not match"); // Reject the mapping
+        }
+		const unsigned char* cursor = base + 6 * sizeof(unsigned int); // Walk the remaining header fields, past the padding word
+		size = *reinterpret_cast<const size_t*>(cursor); // Table size from the image
+		cursor += sizeof(size_t); // Advance past the size
+		count = *reinterpret_cast<const size_t*>(cursor); // Element count from the image
+		cursor += 2 * sizeof(size_t) + sizeof(double); // Skip the tombstone count and load factor: a read-only view needs neither
+		if (size < static_cast<size_t>(Table::GROUP_SIZE) || bytes < headerBytes + size * (1 + sizeof(K) + sizeof(V) + sizeof(size_t))) { // The arrays must fit inside the mapping
+			throw runtime_error("Truncated hash table image"); // Reject the mapping
+        }
+		meta = cursor; // The metadata bytes follow the header
+		keys = reinterpret_cast<const K*>(meta + size); // The key array follows the metadata
+		values = reinterpret_cast<const V*>(reinterpret_cast<const unsigned char*>(keys) + size * sizeof(K)); // The value array follows the keys
+		hashes = reinterpret_cast<const size_t*>(reinterpret_cast<const unsigned char*>(values) + size * sizeof(V)); // The hash cache follows the values
+    }
+
+// This section defines the public interface: opening an image and read-only lookups.
+public: // Public section for external interface methods
+	explicit MappedHashTableView(const string& path) // Constructor mapping an image file read-only
+		: mapping(nullptr), mappingBytes(0), meta(nullptr), keys(nullptr), values(nullptr), hashes(nullptr), size(0), count(0) { // Start detached so the destructor is safe after a throw
+#if defined(_WIN32) // Windows mapping path
+		file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr); // Open the image read-only
+		if (file == INVALID_HANDLE_VALUE) { // The file could not be opened
+			throw runtime_error("Cannot open hash table image: " + path); // Surface the failure
+        }
+		LARGE_INTEGER fileBytes; // Receives the file size
+		if (!GetFileSizeEx(file, &fileBytes)) { // The size could not be read
+			CloseHandle(file); // Release the file handle
+			throw runtime_error("Cannot open hash table image: " + path); // Surface the failure
+        }
+		section = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr); // Create the read-only mapping object
+		if (section == nullptr) { // The mapping object could not be created
+			CloseHandle(file); // Release the file handle
+			throw runtime_error("Cannot map hash table image: " + path); // Surface the failure
+        }
+		mapping = static_cast<const unsigned char*>(MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0)); // Map the whole image
+		if (mapping == nullptr) { // The view could not be mapped
+			CloseHandle(section); // Release the mapping object
+			CloseHandle(file); // Release the file handle
+			throw runtime_error("Cannot map hash table image: " + path); // Surface the failure
+        }
+		mappingBytes = static_cast<size_t>(fileBytes.QuadPart); // Remember the mapped length
+#else // POSIX mapping path
+		int fd = open(path.c_str(), O_RDONLY); // Open the image read-only
+		if (fd < 0) { // The file could not be opened
+			throw runtime_error("Cannot open hash table image: " + path); // Surface the failure
+        }
+		struct stat st; // Receives the file size
+		if (fstat(fd, &st) != 0) { // The size could not be read
+			close(fd); // Release the descriptor
+			throw runtime_error("Cannot open hash table image: " + path); // Surface the failure
+        }
+		mappingBytes = static_cast<size_t>(st.st_size); // Remember the mapped length
+		void* base = mmap(nullptr, mappingBytes, PROT_READ, MAP_SHARED, fd, 0); // Map the whole image; MAP_SHARED shares pages across processes
+		close(fd); // The mapping keeps the file alive; the descriptor is no longer needed
+		if (base == MAP_FAILED) { // The image could not be mapped
+			throw runtime_error("Cannot map hash table image: " + path); // Surface the failure
+        }
+		mapping = static_cast<const unsigned char*>(base); // Adopt the mapping
+#endif
+		try { // Header validation may reject the image
+			attach(mapping, mappingBytes); // Validate the header and aim the array pointers
+        }
+		catch (...) { // The image was rejected
+			unmap(); // Release the mapping before rethrowing
+			throw; // Propagate the validation error
+        }
+    }
+
+	MappedHashTableView(const MappedHashTableView&) = delete; // Views are not copyable: they own the mapping
+	MappedHashTableView& operator=(const MappedHashTableView&) = delete; // Views are not assignable for the same reason
+
+	~MappedHashTableView() { unmap(); } // Destructor releasing the mapping
+
+	// Look up a key. Returns a pointer into the mapping or nullptr; the pointer stays valid for
+	// the view's lifetime. This is HashTable's own probe loop running over the mapped arrays.
+	template <typename LK> // Lookup key type
+	const V* find(const LK& key) const { // Read-only lookup implementation
+		return Table::probeFind(meta, keys, values, hashes, size, hashKey(key), key); // Probe the mapped arrays with the shared loop
+    }
+
+	template <typename LK> // Lookup key type
+	V retrieve(const LK& key) const { // Retrieve a value, throwing if not found
+		const V* value = find(key); // Probe for the key without throwing
+		if (value == nullptr) { // If key was not found
+			throw runtime_error("Key not found"); // Throw exception if key is not found
+        }
+		return *value; // Return a copy of the value
+    }
+
+	template <typename LK> // Lookup key type
+	bool contains(const LK& key) const { return find(key) != nullptr; } // Whether a key is present in the image
+
+	size_t getSize() const { return size; } // Getter method for the image's table size
+	size_t getCount() const { return count; } // Getter method for the image's element count
+
+private: // Private section for teardown
+	void unmap() { // Release the mapping and any platform handles
+		if (mapping != nullptr) { // Only if the map succeeded
+#if defined(_WIN32) // Windows teardown
+			UnmapViewOfFile(mapping); // Unmap the view
+			CloseHandle(section); // Release the mapping object
+			CloseHandle(file); // Release the file handle
+#else // POSIX teardown
+			munmap(const_cast<unsigned char*>(mapping), mappingBytes); // Unmap the image
+#endif
+			mapping = nullptr; // Mark the view detached
+        }
+    }
+};
+
+#endif // End of include guard for MAPPED_HASH_TABLE_H
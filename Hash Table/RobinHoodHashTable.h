@@ -0,0 +1,201 @@
+/*
+This file implements a templated RobinHoodHashTable class: open addressing with linear probing,
+Robin Hood displacement, and backward-shift deletion. Linear probing keeps every probe step on
+the next cache line instead of a random one, Robin Hood displacement (evict an element whose
+probe distance is shorter than the incoming element's) bounds the variance of probe lengths at
+high load, and backward-shift deletion removes elements without tombstones, so probe chains
+never accumulate dead slots. It trades HashTable's SIMD group scans for strictly sequential
+memory access; lookup-heavy tables at high load factors are the workload it exists for.
+*/
+
+#ifndef ROBIN_HOOD_HASH_TABLE_H // Include guard to prevent duplicate definitions
+#define ROBIN_HOOD_HASH_TABLE_H // This line defines the header file if it has not been defined before
+
+#include <vector> // Include vector for dynamic array storage
+#include <stdexcept> // Include stdexcept for runtime_error
+#include <functional> // Include functional for hash
+#include <utility> // Include utility for move and swap
+#include <ostream> // Include ostream for the print() debugging helper
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section initializes the Robin Hood table with a given size or default size. Each slot
+// stores its element's probe distance (how far it sits from its home slot); -1 marks an empty
+// slot. The table invariant is that along any probe chain, stored distances never decrease by
+// more than one step, which both bounds lookups and drives the displacement and deletion logic.
+template <typename K, typename V, typename Hasher = hash<K>> // Template for key, value, and hash policy types
+class RobinHoodHashTable { // RobinHoodHashTable class definition
+private: // Private section for internal data and helper methods
+	static const int DEFAULT_SIZE = 16; // Default size for the hash table, always a power of two
+
+	int size; // Current size of the hash table, always a power of two
+	int count; // Number of elements in the hash table
+	double maxLoadFactor; // Load-factor threshold that triggers a resize
+	vector<int> probeDist; // Probe distance per slot, -1 for empty
+	vector<K> keys; // Keys stored separately so probe misses never drag values through cache
+	vector<V> values; // Values stored separately, touched only on a confirmed hit
+	vector<size_t> hashes; // Cached full hash value per slot, so probes and resize never re-hash keys
+	Hasher hasher; // The table's hash policy instance, default-constructed
+
+	static int roundUpToPowerOfTwo(int s) { // Round a requested size up to the next power of two
+		int p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested size
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+	int homeIndex(size_t h) const { // The slot a hash lands on before any displacement
+		return static_cast<int>(h & static_cast<size_t>(size - 1)); // Bitmask index over the power-of-two size
+    }
+
+	// The displacement loop shared by insert and resize. The incoming element walks its probe
+	// chain; whenever it meets an element closer to home than itself (a "richer" one), the two
+	// swap and the evicted element carries on looking for a slot. Every element therefore ends
+	// up within a tightly bounded distance of its home slot.
+	void placeSlot(size_t h, K key, V value) { // Robin Hood displacement loop taking a precomputed hash
+		int index = homeIndex(h); // Start at the home slot
+		int dist = 0; // Distance the carried element has traveled from its home
+		while (true) { // Walk the probe chain
+			if (probeDist[index] < 0) { // Empty slot: the carried element settles here
+				keys[index] = move(key); // Move the key into the slot
+				values[index] = move(value); // Move the value into the slot
+				hashes[index] = h; // Cache the full hash for lookups and resize
+				probeDist[index] = dist; // Record how far from home it settled
+				count++; // Increment count
+				return; // Exit loop
+            }
+			if (hashes[index] == h && keys[index] == key) { // Cached hash filters out mismatches before the key compare
+				values[index] = move(value); // Key already present: overwrite the value in place
+				return; // Exit loop
+            }
+			if (probeDist[index] < dist) { // The resident is closer to home than the carried element
+				swap(key, keys[index]); // Swap the carried element in
+				swap(value, values[index]); // The evicted resident is carried onward instead
+				swap(h, hashes[index]); // Swap the cached hashes with them
+				swap(dist, probeDist[index]); // And the distances: the eviction keeps the invariant
+            }
+			index = (index + 1) & (size - 1); // Linear probing: the next slot is the next cache line
+			dist++; // The carried element is now one slot further from home
+        }
+    }
+
+	void resize() { // Resize method to increase the size of the hash table
+		vector<int> oldDist = move(probeDist); // Move old distances out instead of copying them
+		vector<K> oldKeys = move(keys); // Move old keys out
+		vector<V> oldValues = move(values); // Move old values out
+		vector<size_t> oldHashes = move(hashes); // Move old cached hashes out
+		int oldSize = size; // Store old size
+		size *= 2; // Double the size, preserving the power-of-two invariant
+		probeDist = vector<int>(size, -1); // Create new distance array with new size
+		keys = vector<K>(size); // Create new key array with new size
+		values = vector<V>(size); // Create new value array with new size
+		hashes = vector<size_t>(size); // Create new hash cache with new size
+		count = 0; // Reset count to 0
+		for (int i = 0; i < oldSize; ++i) { // Iterate over old table
+			if (oldDist[i] >= 0) { // If slot holds an element
+				placeSlot(oldHashes[i], move(oldKeys[i]), move(oldValues[i])); // Reuse the cached hash: resize never re-hashes a key
+            }
+        }
+    }
+
+	int findIndex(const K& key, size_t h) const { // Slot index of a key, or -1 on a miss
+		int index = homeIndex(h); // Start at the home slot
+		int dist = 0; // Distance traveled from the home slot
+		while (probeDist[index] >= dist) { // The key cannot sit past a slot poorer than the probe itself
+			if (hashes[index] == h && keys[index] == key) { // Cached hash filters out mismatches before the key compare
+				return index; // Found the key's slot
+            }
+			index = (index + 1) & (size - 1); // Linear probing: the next slot is the next cache line
+			dist++; // One slot further from home
+        }
+		return -1; // Key not found: an empty slot or a richer resident ends the chain
+    }
+
+// This section defines the public interface of the RobinHoodHashTable class.
+public: // Public section for external interface methods
+	RobinHoodHashTable(int s = DEFAULT_SIZE, double loadFactor = 0.9) // Constructor taking an initial size and load-factor threshold
+		: size(roundUpToPowerOfTwo(s < DEFAULT_SIZE ? DEFAULT_SIZE : s)), count(0), // Round the requested size up to a power of two
+		maxLoadFactor(loadFactor), // Robin Hood tolerates higher load than plain probing, so the default threshold is higher
+		probeDist(size, -1), // Create distance array at the rounded size, all slots empty
+		keys(size), values(size), hashes(size) { // Create key, value, and hash storage at the rounded size
+    }
+
+	void insert(const K& key, const V& value) { // Method to insert key-value pair by copy
+		if (static_cast<double>(count + 1) / size > maxLoadFactor) { // Check load factor; there are no tombstones to count
+			resize(); // Resize the hash table
+        }
+		placeSlot(hasher(key), key, value); // Hash once, then displace into place
+    }
+
+	void insert(K&& key, V&& value) { // Method to insert key-value pair by move
+		if (static_cast<double>(count + 1) / size > maxLoadFactor) { // Check load factor; there are no tombstones to count
+			resize(); // Resize the hash table
+        }
+		size_t h = hasher(key); // Hash before the key is moved
+		placeSlot(h, move(key), move(value)); // Displace into place without copying
+    }
+
+	V retrieve(const K& key) const { // Method to retrieve value for key, throws if not found
+		const V* value = find(key); // Probe for the key without throwing
+		if (value == nullptr) { // If key was not found
+			throw runtime_error("Key not found"); // Throw exception if key is not found
+        }
+		return *value; // Return a copy of the value
+    }
+
+	const V* find(const K& key) const { // Const method to find value for key, returns nullptr if not found
+		int index = findIndex(key, hasher(key)); // Probe for the key's slot
+		return index < 0 ? nullptr : &values[index]; // Pointer to the value, or nullptr on a miss
+    }
+
+	V* find(const K& key) { // Method to find value for key, returns nullptr if not found
+		return const_cast<V*>(static_cast<const RobinHoodHashTable*>(this)->find(key)); // Reuse the const probe loop
+    }
+
+	// Remove a key-value pair by backward shifting: every element in the following run whose
+	// probe distance is non-zero moves one slot back toward its home. No tombstone is left
+	// behind, so chains stay exactly as long as their live elements require.
+	void remove(const K& key) { // Remove method implementation
+		int index = findIndex(key, hasher(key)); // Probe for the key's slot
+		if (index < 0) { // If key was not found
+			return; // Nothing to remove
+        }
+		count--; // Decrement count
+		int next = (index + 1) & (size - 1); // The slot after the hole
+		while (probeDist[next] > 0) { // Elements at their home slot (distance 0) end the shifted run
+			keys[index] = move(keys[next]); // Shift the element back into the hole
+			values[index] = move(values[next]); // Shift its value with it
+			hashes[index] = hashes[next]; // Shift its cached hash with it
+			probeDist[index] = probeDist[next] - 1; // It is now one slot closer to home
+			index = next; // The hole moves forward
+			next = (next + 1) & (size - 1); // Examine the next slot
+        }
+		keys[index] = K(); // Drop the trailing slot's key so its resources are released
+		values[index] = V(); // Drop the trailing slot's value so its resources are released
+		probeDist[index] = -1; // The trailing slot becomes empty, ending the chain
+    }
+
+	int getSize() const { return size; } // Getter method for size
+	int getCount() const { return count; } // Getter method for count
+
+	void print(ostream& out) const { // Method to print the contents of the hash table to a caller-provided stream
+		for (int i = 0; i < size; ++i) { // Iterate over table
+			if (probeDist[i] >= 0) { // If slot is occupied
+				out << "Index " << i << ": Key = " << keys[i] // Output key-value pair
+					<< ", Value = " << values[i] << ", Distance = " << probeDist[i] << endl; // Including its probe distance
+            }
+        }
+		out << "Size: " << size << ", Count: " << count << endl; // Output size and count
+    }
+
+	void clear() { // Method to clear the hash table
+		probeDist = vector<int>(size, -1); // Create new distance array with same size, all slots empty
+		keys = vector<K>(size); // Create new key storage with same size
+		values = vector<V>(size); // Create new value storage with same size
+		hashes = vector<size_t>(size); // Create new hash cache with same size
+		count = 0; // Reset count to 0
+    }
+};
+
+#endif // End of include guard for ROBIN_HOOD_HASH_TABLE_H
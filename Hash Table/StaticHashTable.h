@@ -0,0 +1,134 @@
+/*
+This file implements a templated StaticHashTable class: a fixed-capacity open-addressing table
+whose capacity is a template parameter, whose storage is std::array, and whose construction and
+probing are constexpr. A table built from a constant initializer is laid out entirely at compile
+time, so static lookup data (opcode names, config enums) lives in .rodata with zero startup cost,
+zero heap allocation, and pages shareable across processes. There is no insert, remove, or
+resize: the element set is fixed when the table is constructed, which is exactly the contract
+static lookup data needs.
+*/
+
+#ifndef STATIC_HASH_TABLE_H // Include guard to prevent duplicate definitions
+#define STATIC_HASH_TABLE_H // This line defines the header file if it has not been defined before
+
+#include <array> // Include array for the fixed-capacity constexpr storage
+#include <cstddef> // Include cstddef for size_t
+#include <stdexcept> // Include stdexcept for runtime_error
+#include <string_view> // Include string_view for constexpr string keys
+#include <type_traits> // Include type_traits for the key-kind dispatch
+#include <utility> // Include utility for pair
+
+using namespace std; // Using standard namespace to avoid writing std:: before standard library functions
+
+// This section defines the constexpr hash policy. std::hash is not constexpr, so the static
+// table ships its own: the same splitmix64 finalizer IntegerMixHash uses for integral keys and
+// the same 64-bit FNV-1a FastStringHash uses for string keys, evaluated at compile time. Keys
+// that should hash as strings must be string_view (a string literal converts), since only
+// string_view is constexpr-capable in C++17.
+struct StaticTableHash { // Constexpr hash policy for compile-time tables
+	template <typename T> // Any integral key type
+	constexpr size_t operator()(T key) const { // Mix the key's bits
+		static_assert(is_integral<T>::value, "StaticTableHash hashes integral and string_view keys"); // Reject other key types at compile time
+		unsigned long long x = static_cast<unsigned long long>(key); // Widen to 64 bits
+		x ^= x >> 30; // First xor-shift
+		x *= 0xBF58476D1CE4E5B9ULL; // First multiply
+		x ^= x >> 27; // Second xor-shift
+		x *= 0x94D049BB133111EBULL; // Second multiply
+		x ^= x >> 31; // Final xor-shift
+		return static_cast<size_t>(x); // Return the mixed hash
+    }
+
+	constexpr size_t operator()(string_view key) const { // Hash the characters
+		unsigned long long h = 0xCBF29CE484222325ULL; // FNV-1a offset basis
+		for (char c : key) { // Walk the bytes
+			h ^= static_cast<unsigned char>(c); // Fold in the byte
+			h *= 0x00000100000001B3ULL; // FNV-1a prime
+        }
+		return static_cast<size_t>(h); // Return the folded hash
+    }
+};
+
+// This section initializes the static table from exactly N key-value pairs. The slot count is
+// the smallest power of two holding N elements at no more than half load, so linear probe
+// chains stay short without any resize machinery. Linear probing is used instead of HashTable's
+// SIMD group scans because probing here must be a constant expression; with load capped at 0.5
+// and no deletions the chains are short enough that this does not matter.
+template <typename K, typename V, size_t N, typename Hasher = StaticTableHash> // Template for key, value, capacity, and hash policy types
+class StaticHashTable { // StaticHashTable class definition
+private: // Private section for internal data and helper methods
+	static constexpr size_t roundUpToPowerOfTwo(size_t s) { // Round a slot requirement up to the next power of two
+		size_t p = 1; // Start from the smallest power of two
+		while (p < s) { // Until p reaches the requested size
+			p <<= 1; // Double p
+        }
+		return p; // Return the power of two
+    }
+
+	static constexpr size_t SLOTS = roundUpToPowerOfTwo(N * 2); // Slot count: a power of two at no more than half load
+
+	array<bool, SLOTS> occupied; // Per-slot occupancy flags; no deletions means no tombstone state
+	array<K, SLOTS> keys; // Key storage, value-initialized then filled during construction
+	array<V, SLOTS> values; // Value storage, value-initialized then filled during construction
+
+	static constexpr Hasher hasher{}; // The table's hash policy instance
+
+	// Probe for a key's slot, returning SLOTS on a miss. Linear probing with the occupancy flag
+	// as the chain terminator: construction never deletes, so an unoccupied slot always ends the
+	// chain. This is the one loop both construction and lookup are built on.
+	constexpr size_t findIndex(const K& key) const { // Lookup probe loop
+		size_t index = hasher(key) & (SLOTS - 1); // Compute home slot from the masked hash
+		while (occupied[index]) { // Probe until an empty slot ends the chain
+			if (keys[index] == key) { // If the slot holds the key
+				return index; // Return its index
+            }
+			index = (index + 1) & (SLOTS - 1); // Step to the next slot, wrapping with a bitmask
+        }
+		return SLOTS; // Key not found
+    }
+
+public: // Public section for external interface methods
+	constexpr StaticHashTable(const pair<K, V> (&items)[N]) // Constructor taking exactly N key-value pairs
+		: occupied{}, keys{}, values{} { // Value-initialize all storage so construction is a constant expression
+		for (size_t i = 0; i < N; ++i) { // Place each pair
+			size_t index = hasher(items[i].first) & (SLOTS - 1); // Compute home slot from the masked hash
+			while (occupied[index]) { // Probe until a free slot is found
+				if (keys[index] == items[i].first) { // If the key is already present
+					throw runtime_error("Duplicate key in static table"); // In a constexpr context this is a compile error at the duplicate
+                }
+				index = (index + 1) & (SLOTS - 1); // Step to the next slot, wrapping with a bitmask
+            }
+			occupied[index] = true; // Mark the slot occupied
+			keys[index] = items[i].first; // Store the key
+			values[index] = items[i].second; // Store the value
+        }
+    }
+
+	constexpr V retrieve(const K& key) const { // Method to retrieve value for key, throws if not found
+		size_t index = findIndex(key); // Probe for the key
+		if (index == SLOTS) { // If key was not found
+			throw runtime_error("Key not found"); // In a constexpr context a miss is a compile error
+        }
+		return values[index]; // Return a copy of the value
+    }
+
+	constexpr const V* find(const K& key) const { // Method to find value for key, returns nullptr if not found
+		size_t index = findIndex(key); // Probe for the key
+		return index == SLOTS ? nullptr : &values[index]; // Pointer into the table, or nullptr on a miss
+    }
+
+	constexpr bool contains(const K& key) const { // Method to check whether a key is present
+		return findIndex(key) != SLOTS; // Presence is a successful probe
+    }
+
+	constexpr size_t getSize() const { return SLOTS; } // Getter method for the slot count
+	constexpr size_t getCount() const { return N; } // Getter method for the element count, fixed at capacity
+};
+
+// This section deduces the capacity from a braced pair array, so call sites write
+// makeStaticHashTable<K, V>({ ... }) without counting their entries by hand.
+template <typename K, typename V, size_t N> // Key, value, and deduced capacity
+constexpr StaticHashTable<K, V, N> makeStaticHashTable(const pair<K, V> (&items)[N]) { // Factory deducing N
+	return StaticHashTable<K, V, N>(items); // Construct the table from the pair array
+}
+
+#endif // End of include guard
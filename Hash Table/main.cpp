@@ -1,129 +1,417 @@
-/* 
-This file contains the main function and performance testing code for the HashTable implementation.
-It includes performance tests for both the custom HashTable and the standard (std::)unordered_map,
-measuring the time taken for insert, retrieve, and remove operations with varying numbers of elements.
-The results are output to the console, allowing for comparison between the custom implementation
-and the standard library container.
+/*
+This file contains the main function and the microbenchmark suite for the HashTable
+implementation. Each operation (insert, find, remove) is timed in its own phase and reported in
+nanoseconds per operation, with an untimed warm-up pass, a fixed number of repetitions on fresh
+tables, deterministic seeds so runs are comparable across builds, and the mean and standard
+deviation across repetitions emitted as CSV for regression tracking. The same phases run against
+std::unordered_map with identical key sequences, so the two engines are compared on the same
+work rather than on different random keys. A second mode ("trace <file>") replays a captured
+operation log against both engines and reports per-operation latency percentiles, and a third
+("scale [maxThreads] [readPercent]") sweeps 1..N threads over ConcurrentHashTable and reports
+aggregate throughput, per-thread throughput, and scaling efficiency.
 */
 
 #include <iostream> // Include iostream for console output
 #include <chrono> // Include chrono for time measurement
-#include <random> // Include random for random number generation
-#include <unordered_map> // Include unordered_map for standard hash table
+#include <random> // Include random for the deterministic key-sequence generator
+#include <unordered_map> // Include unordered_map for the standard hash table baseline
+#include <vector> // Include vector for key sequences and per-repetition samples
+#include <string> // Include string for engine and operation labels
+#include <algorithm> // Include algorithm for shuffle
+#include <cmath> // Include cmath for sqrt in the standard deviation
+#include <fstream> // Include fstream for reading trace files
+#include <stdexcept> // Include stdexcept for trace-parsing errors
+#include <thread> // Include thread for the scaling benchmark's workers
+#include <atomic> // Include atomic for the workers' start gate
 #include "HashTable.h" // Include custom HashTable implementation
+#include "ConcurrentHashTable.h" // Include the sharded table the scaling benchmark drives
 
 using namespace std; // using standard namespace to avoid writing std:: before standard library functions
 using namespace chrono; // using chrono namespace to avoid writing chrono:: before time measurement functions
 
-// Performance test for custom HashTable
-template <typename K, typename V> // Template for key-value pair types
-void performanceTestCustom(HashTable<K, V>& hashTable, int operations) { // Performance test method
-	random_device rd; // Random device for seed
-	mt19937 gen(rd()); // Mersenne Twister engine for random number generation
-	uniform_int_distribution<> dis(1, 1000000); // Uniform distribution for random numbers
+static const int BENCH_REPETITIONS = 5; // Timed repetitions per configuration, each on a fresh table
+static const unsigned int BENCH_SEED = 42; // Fixed seed so every run benchmarks the same key sequences
 
-	auto start = high_resolution_clock::now(); // Start time measurement
+// Build the benchmark's key sequence: the values 0..n-1 shuffled with a fixed seed. Every engine
+// and every repetition sees the same sequence, so differences in the numbers come from the
+// engines, not the keys. Miss keys live in a disjoint range so lookups of them never hit.
+static vector<int> makeKeys(int n) { // Key-sequence builder
+	vector<int> keys(n); // The sequence being built
+	for (int i = 0; i < n; ++i) { // Fill with distinct values
+		keys[i] = i; // Sequential before shuffling
+    }
+	mt19937 gen(BENCH_SEED); // Fixed-seed generator: identical sequence on every run
+	shuffle(keys.begin(), keys.end(), gen); // Shuffle into a reproducible random order
+	return keys; // Return the sequence
+}
 
-	int successfulInserts = 0; // Counter for successful inserts
-	int successfulRetrieves = 0; // Counter for successful retrieves
-	int successfulRemoves = 0; // Counter for successful removes
+// Mean and standard deviation of the per-repetition samples, the two numbers the CSV reports.
+static void summarize(const vector<double>& samples, double& mean, double& stddev) { // Sample summarizer
+	mean = 0.0; // Accumulated mean
+	for (double s : samples) { // Sum the samples
+		mean += s; // Accumulate
+    }
+	mean /= samples.size(); // Divide into the mean
+	double variance = 0.0; // Accumulated squared deviation
+	for (double s : samples) { // Sum the squared deviations
+		variance += (s - mean) * (s - mean); // Accumulate
+    }
+	stddev = sqrt(variance / samples.size()); // Population standard deviation across repetitions
+}
 
-	for (int i = 0; i < operations; ++i) { // Loop for insert operations
-		int key = dis(gen); // Generate random key
-		int value = dis(gen); // Generate random value
-		try { // Try to insert key-value pair
-			hashTable.insert(key, value); // Insert key-value pair
-			successfulInserts++; // Increment successful inserts counter
+// Emit one CSV row. The header is printed once by main(), so output can be appended straight
+// into the regression-tracking sheet.
+static void reportRow(const string& engine, int elements, const string& operation, double meanNs, double stddevNs) { // CSV row writer
+	cout << engine << "," << elements << "," << operation << "," // Identify the configuration
+		<< BENCH_REPETITIONS << "," << meanNs << "," << stddevNs << endl; // And its numbers
+}
+
+// Time one already-built phase closure over n operations and return nanoseconds per operation.
+template <typename F> // Phase callable running all n operations
+static double timePhase(int n, F&& phase) { // Phase timer
+	auto start = high_resolution_clock::now(); // Start time measurement
+	phase(); // Run the whole phase
+	auto end = high_resolution_clock::now(); // End time measurement
+	return static_cast<double>(duration_cast<nanoseconds>(end - start).count()) / n; // Nanoseconds per operation
+}
+
+// Benchmark the custom HashTable at one element count: a fresh table per repetition, separate
+// timed phases for insert, find hits, find misses, and remove, preceded by one untimed warm-up
+// repetition that pages in code and warms the allocator. Templated on the hash policy so the
+// default hash<int> (the identity on the major standard libraries, which clusters sequential
+// keys) and the shipped IntegerMixHash appear as separate engines in the CSV.
+template <typename Hasher> // Hash policy under test
+static void benchmarkCustom(const string& engine, int elements) { // Custom HashTable benchmark
+	vector<int> keys = makeKeys(elements); // The shared key sequence
+	vector<double> insertNs, findNs, missNs, removeNs; // Per-repetition samples per phase
+	for (int rep = 0; rep <= BENCH_REPETITIONS; ++rep) { // Repetition 0 is the untimed warm-up
+		HashTable<int, int, Hasher> table; // Fresh table: repetitions never inherit occupancy from each other
+		double ins = timePhase(elements, [&] { // Insert phase
+			for (int k : keys) { // Every key once
+				table.insert(k, k); // Insert key-value pair
+            }
+        });
+		long long sink = 0; // Accumulator the finds feed, so the optimizer cannot drop them
+		double fnd = timePhase(elements, [&] { // Find-hit phase
+			for (int k : keys) { // Every key once, all present
+				const int* v = table.find(k); // Probe for the key
+				sink += v != nullptr ? *v : 0; // Consume the result
+            }
+        });
+		double mis = timePhase(elements, [&] { // Find-miss phase
+			for (int k : keys) { // Every key shifted into the disjoint miss range
+				sink += table.find(k + elements) != nullptr ? 1 : 0; // Probe for a key that is never present
+            }
+        });
+		double rem = timePhase(elements, [&] { // Remove phase
+			for (int k : keys) { // Every key once
+				table.remove(k); // Remove key
+            }
+        });
+		if (sink == 123456789) { // Impossible value, but the compiler cannot prove it
+			cerr << "sink" << endl; // Keeps the accumulator observable
         }
-		catch (const exception& e) { // Catch any exceptions
-			cerr << "Error during insertion: " << e.what() << endl; // Output error message
-			break; // Break out of loop
+		if (rep > 0) { // The warm-up repetition is not recorded
+			insertNs.push_back(ins); // Record the insert sample
+			findNs.push_back(fnd); // Record the find-hit sample
+			missNs.push_back(mis); // Record the find-miss sample
+			removeNs.push_back(rem); // Record the remove sample
         }
     }
+	double mean, stddev; // Receives each phase's summary
+	summarize(insertNs, mean, stddev); // Summarize the insert phase
+	reportRow(engine, elements, "insert", mean, stddev); // Report the insert phase
+	summarize(findNs, mean, stddev); // Summarize the find-hit phase
+	reportRow(engine, elements, "find_hit", mean, stddev); // Report the find-hit phase
+	summarize(missNs, mean, stddev); // Summarize the find-miss phase
+	reportRow(engine, elements, "find_miss", mean, stddev); // Report the find-miss phase
+	summarize(removeNs, mean, stddev); // Summarize the remove phase
+	reportRow(engine, elements, "remove", mean, stddev); // Report the remove phase
+}
 
-	for (int i = 0; i < operations; ++i) { // Loop for retrieve operations
-		int key = dis(gen); // Generate random key
-		try { // Try to retrieve value for key
-			hashTable.retrieve(key); // Retrieve value for key
-			successfulRetrieves++; // Increment successful retrieves counter
+// Benchmark std::unordered_map with the identical phases and key sequences, the baseline every
+// custom number is read against.
+static void benchmarkStd(int elements) { // Standard unordered_map benchmark
+	vector<int> keys = makeKeys(elements); // The shared key sequence
+	vector<double> insertNs, findNs, missNs, removeNs; // Per-repetition samples per phase
+	for (int rep = 0; rep <= BENCH_REPETITIONS; ++rep) { // Repetition 0 is the untimed warm-up
+		unordered_map<int, int> table; // Fresh table: repetitions never inherit occupancy from each other
+		double ins = timePhase(elements, [&] { // Insert phase
+			for (int k : keys) { // Every key once
+				table.insert({ k, k }); // Insert key-value pair
+            }
+        });
+		long long sink = 0; // Accumulator the finds feed, so the optimizer cannot drop them
+		double fnd = timePhase(elements, [&] { // Find-hit phase
+			for (int k : keys) { // Every key once, all present
+				auto it = table.find(k); // Probe for the key
+				sink += it != table.end() ? it->second : 0; // Consume the result
+            }
+        });
+		double mis = timePhase(elements, [&] { // Find-miss phase
+			for (int k : keys) { // Every key shifted into the disjoint miss range
+				sink += table.find(k + elements) != table.end() ? 1 : 0; // Probe for a key that is never present
+            }
+        });
+		double rem = timePhase(elements, [&] { // Remove phase
+			for (int k : keys) { // Every key once
+				table.erase(k); // Remove key
+            }
+        });
+		if (sink == 123456789) { // Impossible value, but the compiler cannot prove it
+			cerr << "sink" << endl; // Keeps the accumulator observable
         }
-		catch (const runtime_error&) { // Key not found, ignore for performance reasons
-			// Uncomment the following line for debugging, but note it will significantly slow down the program and print a lot to screen
-			//cerr << "Key not found: " << key << endl;		
-        }
-		catch (const exception& e) { // Catch any other exceptions
-			cerr << "Error during retrieval: " << e.what() << endl; // Output error message
+		if (rep > 0) { // The warm-up repetition is not recorded
+			insertNs.push_back(ins); // Record the insert sample
+			findNs.push_back(fnd); // Record the find-hit sample
+			missNs.push_back(mis); // Record the find-miss sample
+			removeNs.push_back(rem); // Record the remove sample
         }
     }
+	double mean, stddev; // Receives each phase's summary
+	summarize(insertNs, mean, stddev); // Summarize the insert phase
+	reportRow("unordered_map", elements, "insert", mean, stddev); // Report the insert phase
+	summarize(findNs, mean, stddev); // Summarize the find-hit phase
+	reportRow("unordered_map", elements, "find_hit", mean, stddev); // Report the find-hit phase
+	summarize(missNs, mean, stddev); // Summarize the find-miss phase
+	reportRow("unordered_map", elements, "find_miss", mean, stddev); // Report the find-miss phase
+	summarize(removeNs, mean, stddev); // Summarize the remove phase
+	reportRow("unordered_map", elements, "remove", mean, stddev); // Report the remove phase
+}
+
+// This section implements the trace-replay mode. Uniform-random loops look nothing like the
+// production access pattern (skewed keys, read-heavy mixes), so this mode reads an operation
+// log captured from production - one "op,key,value" CSV line per operation, op being get,
+// insert, or remove - replays it against both engines, and reports per-operation latency
+// percentiles, the numbers that actually predict deployment behavior.
+
+struct TraceOp { // One operation from a captured trace
+	char op; // 'g' for get, 'i' for insert, 'r' for remove
+	int key; // The operation's key
+	int value; // The value for inserts, ignored otherwise
+};
 
-	for (int i = 0; i < operations; ++i) { // Loop for remove operations
-		int key = dis(gen); // Generate random key
-		try { // Try to remove key
-			hashTable.remove(key); // Remove key
-			successfulRemoves++; // Increment successful removes counter
+// Parse a trace file into memory up front, so file I/O never lands inside a timed operation.
+static vector<TraceOp> loadTrace(const string& path) { // Trace loader
+	ifstream in(path); // Open the trace file
+	if (!in) { // The file could not be opened
+		throw runtime_error("Cannot open trace file: " + path); // Surface the failure
+    }
+	vector<TraceOp> trace; // The parsed operations
+	string line; // One CSV line per operation
+	while (getline(in, line)) { // Read the trace line by line
+		if (line.empty() || line[0] == '#') { // Skip blank lines and comments
+			continue; // Nothing to parse
+        }
+		size_t firstComma = line.find(','); // End of the op field
+		if (firstComma == string::npos) { // Malformed line
+			throw runtime_error("Malformed trace line: " + line); // Surface the bad input rather than skewing the replay
         }
-		catch (const exception& e) { // Catch any exceptions
-			cerr << "Error during removal: " << e.what() << endl; // Output error message
+		size_t secondComma = line.find(',', firstComma + 1); // End of the key field, absent for get/remove
+		TraceOp op; // The operation being parsed
+		string opName = line.substr(0, firstComma); // The op field
+		if (opName == "get") { op.op = 'g'; } // Lookup operation
+		else if (opName == "insert") { op.op = 'i'; } // Insert operation
+		else if (opName == "remove") { op.op = 'r'; } // Remove operation
+		else { // Unknown operation name
+			throw runtime_error("Unknown trace operation: " + opName); // Surface the bad input
         }
+		op.key = stoi(line.substr(firstComma + 1)); // Parse the key field
+		op.value = secondComma == string::npos ? 0 : stoi(line.substr(secondComma + 1)); // Parse the value field when present
+		trace.push_back(op); // Keep the operation
     }
-
-	auto end = high_resolution_clock::now(); // End time measurement
-	auto duration = duration_cast<milliseconds>(end - start); // Calculate duration
-	cout << "Time taken for " << operations << " operations: " << duration.count() << " ms" << endl; // Output time taken
-	cout << "Successful inserts: " << successfulInserts << endl; // Output successful inserts
-	cout << "Successful retrieves: " << successfulRetrieves << endl; // Output successful retrieves
-	cout << "Successful removes: " << successfulRemoves << endl; // Output successful removes
-	cout << "Final hash table size: " << hashTable.getSize() << endl; // Output final size
-	cout << "Final hash table count: " << hashTable.getCount() << endl; // Output final count
+	return trace; // Return the parsed trace
 }
 
-// Performance test for standard unordered_map
-void performanceTestStd(unordered_map<int, int>& hashTable, int operations) { // Performance test method
-	random_device rd; // Random device for seed
-	mt19937 gen(rd()); // Mersenne Twister engine for random number generation
-	uniform_int_distribution<> dis(1, 1000000); // Uniform distribution for random numbers
+static double percentile(const vector<double>& sorted, double p) { // The p-th percentile of a sorted sample set
+	if (sorted.empty()) { // No samples for this operation type
+		return 0.0; // Report zero rather than indexing nothing
+    }
+	size_t index = static_cast<size_t>(p * (sorted.size() - 1)); // Nearest-rank index into the sorted samples
+	return sorted[index]; // Return the sample at that rank
+}
 
-	auto start = high_resolution_clock::now(); // Start time measurement
+static void reportTraceRow(const string& engine, const string& operation, vector<double>& samples) { // Percentile CSV row writer
+	sort(samples.begin(), samples.end()); // Percentiles need the samples in order
+	cout << engine << "," << operation << "," << samples.size() << "," // Identify the configuration
+		<< percentile(samples, 0.50) << "," << percentile(samples, 0.90) << "," // Median and tail
+		<< percentile(samples, 0.99) << "," << percentile(samples, 0.999) << "," // Deep tail
+		<< (samples.empty() ? 0.0 : samples.back()) << endl; // Worst observed operation
+}
 
-	for (int i = 0; i < operations; ++i) { // Loop for insert operations
-		int key = dis(gen); // Generate random key
-		int value = dis(gen); // Generate random value
-		hashTable.insert({ key, value }); // Insert key-value pair
+// Replay the trace against one engine, timing every operation individually. The three lambdas
+// adapt the engine's interface, so HashTable and unordered_map replay identical work.
+template <typename G, typename I, typename R> // Adapters for get, insert, and remove
+static void replayTrace(const string& engine, const vector<TraceOp>& trace, G&& get, I&& insert, R&& remove) { // Trace replay loop
+	vector<double> getNs, insertNs, removeNs; // Per-operation latency samples by type
+	getNs.reserve(trace.size()); // Reserve for the worst case so sampling never reallocates mid-replay
+	insertNs.reserve(trace.size()); // Same for inserts
+	removeNs.reserve(trace.size()); // Same for removes
+	for (const TraceOp& op : trace) { // Replay in captured order
+		auto start = high_resolution_clock::now(); // Start this operation's measurement
+		if (op.op == 'g') { get(op.key); } // Replay a lookup
+		else if (op.op == 'i') { insert(op.key, op.value); } // Replay an insert
+		else { remove(op.key); } // Replay a remove
+		auto end = high_resolution_clock::now(); // End this operation's measurement
+		double ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()); // This operation's latency
+		if (op.op == 'g') { getNs.push_back(ns); } // Sample by operation type
+		else if (op.op == 'i') { insertNs.push_back(ns); } // Sample by operation type
+		else { removeNs.push_back(ns); } // Sample by operation type
     }
+	reportTraceRow(engine, "get", getNs); // Report the lookup percentiles
+	reportTraceRow(engine, "insert", insertNs); // Report the insert percentiles
+	reportTraceRow(engine, "remove", removeNs); // Report the remove percentiles
+}
 
-	for (int i = 0; i < operations; ++i) { // Loop for retrieve operations
-		int key = dis(gen); // Generate random key
-		auto it = hashTable.find(key); // Find key in hash table
-		if (it != hashTable.end()) { // If key is found
-			// Uncomment the following line for debugging, but note it will significantly slow down the program and print a LOT of output to screen
-			//cout << "Retrieved value for key " << key << ": " << it->second << endl;            
-        }
+// Run the trace-replay mode: load the trace once, replay it against both engines, and emit one
+// percentile CSV table on stdout.
+static int runTraceMode(const string& path) { // Trace mode entry point
+	vector<TraceOp> trace = loadTrace(path); // Parse the whole trace up front
+	cout << "engine,operation,ops,p50_ns,p90_ns,p99_ns,p999_ns,max_ns" << endl; // CSV header, printed once
+	HashTable<int, int> custom; // Custom HashTable instance the trace runs against
+	long long sink = 0; // Accumulator the lookups feed, so the optimizer cannot drop them
+	replayTrace("HashTable", trace, // Replay against the custom table
+		[&](int key) { const int* v = custom.find(key); sink += v != nullptr ? *v : 0; }, // Lookup adapter
+		[&](int key, int value) { custom.insert(key, value); }, // Insert adapter
+		[&](int key) { custom.remove(key); }); // Remove adapter
+	unordered_map<int, int> standard; // Standard unordered_map instance the trace runs against
+	replayTrace("unordered_map", trace, // Replay against the standard baseline
+		[&](int key) { auto it = standard.find(key); sink += it != standard.end() ? it->second : 0; }, // Lookup adapter
+		[&](int key, int value) { standard[key] = value; }, // Insert adapter
+		[&](int key) { standard.erase(key); }); // Remove adapter
+	if (sink == 123456789) { // Impossible value, but the compiler cannot prove it
+		cerr << "sink" << endl; // Keeps the accumulator observable
     }
+	return 0; // Return 0 to indicate successful completion
+}
 
-	for (int i = 0; i < operations; ++i) { // Loop for remove operations
-		int key = dis(gen); // Generate random key
-		hashTable.erase(key); // Remove key from hash table
-    }
+// This section implements the multithreaded scaling mode. It drives ConcurrentHashTable with
+// 1..N threads at a configurable read/write mix and reports aggregate and per-thread throughput
+// plus scaling efficiency (aggregate throughput at N threads relative to N times the one-thread
+// aggregate), the curve fleet sizing is based on. A single-threaded plain-HashTable run of the
+// same workload is reported first as the no-locking reference.
 
-	auto end = high_resolution_clock::now(); // End time measurement
-	auto duration = duration_cast<milliseconds>(end - start); // Calculate duration
-	cout << "Time taken for " << operations << " operations: " << duration.count() << " ms" << endl; // Output time taken
-}
+static const int SCALE_KEY_RANGE = 100000; // Distinct keys the scaling workload touches
+static const int SCALE_OPS_PER_THREAD = 1000000; // Operations each worker thread performs
 
-// Main function: Runs performance tests on custom HashTable and standard unordered_map
-int main() { // Main function
-	HashTable<int, int> customHashTable; // Custom HashTable instance
-	unordered_map<int, int> stdHashTable; // Standard unordered_map instance
+// One worker's operation loop, shared by the reference and concurrent runs through an adapter
+// triple. Each worker mixes operations with its own deterministically-seeded generator: reads
+// with probability readPercent, the rest split evenly between inserts and removes.
+template <typename G, typename I, typename R> // Adapters for get, insert, and remove
+static void scaleWorker(int threadId, int readPercent, G&& get, I&& insert, R&& remove) { // Worker operation loop
+	mt19937 gen(BENCH_SEED + static_cast<unsigned int>(threadId)); // Per-thread fixed seed: reruns replay the same mix
+	uniform_int_distribution<int> keyDis(0, SCALE_KEY_RANGE - 1); // Keys drawn uniformly from the shared range
+	uniform_int_distribution<int> mixDis(0, 99); // Percent roll selecting the operation type
+	for (int i = 0; i < SCALE_OPS_PER_THREAD; ++i) { // Fixed operation count per worker
+		int key = keyDis(gen); // This operation's key
+		int roll = mixDis(gen); // This operation's type roll
+		if (roll < readPercent) { get(key); } // Read share of the mix
+		else if ((roll & 1) == 0) { insert(key, i); } // Half the writes insert
+		else { remove(key); } // The other half remove
+    }
+}
 
-	cout << "Custom Hash Table Performance:" << endl; // Output custom hash table performance message
-	performanceTestCustom(customHashTable, 100); // Perform custom hash table test with 100 operations
-	performanceTestCustom(customHashTable, 1000); // Perform custom hash table test with 1000 operations
-	performanceTestCustom(customHashTable, 10000); // Perform custom hash table test with 10000 operations
+static void reportScaleRow(const string& engine, int threads, int readPercent, double seconds, double baselineOpsPerSec) { // Scaling CSV row writer
+	double totalOps = static_cast<double>(threads) * SCALE_OPS_PER_THREAD; // Operations performed across all workers
+	double opsPerSec = totalOps / seconds; // Aggregate throughput
+	double efficiency = baselineOpsPerSec > 0.0 ? opsPerSec / (threads * baselineOpsPerSec) : 1.0; // Aggregate versus perfect scaling of the one-thread run
+	cout << engine << "," << threads << "," << readPercent << "," << static_cast<long long>(totalOps) << "," // Identify the configuration
+		<< seconds << "," << opsPerSec << "," << opsPerSec / threads << "," << efficiency << endl; // And its throughput numbers
+}
 
-	cout << "\nStandard Hash Table Performance:" << endl; // Output standard hash table performance message
-	performanceTestStd(stdHashTable, 100); // Perform standard hash table test with 100 operations
-	performanceTestStd(stdHashTable, 1000); // Perform standard hash table test with 1000 operations
-	performanceTestStd(stdHashTable, 10000); // Perform standard hash table test with 10000 operations
+// Run the scaling mode: preload the key range, then sweep thread counts on ConcurrentHashTable.
+// Workers are released together through an atomic gate so the measured window contains only
+// table operations, never thread startup.
+static int runScaleMode(int maxThreads, int readPercent) { // Scaling mode entry point
+	cout << "engine,threads,read_pct,total_ops,seconds,ops_per_sec,ops_per_sec_per_thread,scaling_efficiency" << endl; // CSV header, printed once
+	long long sink = 0; // Accumulator the reference run's lookups feed
+	HashTable<int, int, IntegerMixHash> reference; // The no-locking single-threaded reference table; the mixing hash
+	// is deliberate: with the identity hash<int>, the preloaded sequential keys form one contiguous
+	// occupied run, and every miss (a read of a removed key) scans to the end of it, which would
+	// dominate the reference row with a hash-policy artifact rather than measuring the table
+	reference.reserve(SCALE_KEY_RANGE); // Size it once for the key range
+	for (int k = 0; k < SCALE_KEY_RANGE; ++k) { // Preload every key
+		reference.insert(k, k); // So reads mostly hit
+    }
+	auto refStart = high_resolution_clock::now(); // Start the reference measurement
+	scaleWorker(0, readPercent, // The identical workload, single-threaded and unlocked
+		[&](int key) { const int* v = reference.find(key); sink += v != nullptr ? *v : 0; }, // Lookup adapter
+		[&](int key, int value) { reference.insert(key, value); }, // Insert adapter
+		[&](int key) { reference.remove(key); }); // Remove adapter
+	auto refEnd = high_resolution_clock::now(); // End the reference measurement
+	double refSeconds = duration_cast<nanoseconds>(refEnd - refStart).count() / 1e9; // Reference wall time
+	reportScaleRow("HashTable+IntegerMixHash", 1, readPercent, refSeconds, 0.0); // Reference row; efficiency is 1 by definition
+	double baselineOpsPerSec = 0.0; // The concurrent table's own one-thread throughput, set by the first sweep step
+	for (int threads = 1; threads <= maxThreads; ++threads) { // Sweep the thread counts
+		ConcurrentHashTable<int, int> table; // Fresh sharded table per thread count
+		table.reserve(SCALE_KEY_RANGE); // Size every shard once for the key range
+		for (int k = 0; k < SCALE_KEY_RANGE; ++k) { // Preload every key
+			table.insert(k, k); // So reads mostly hit
+        }
+		atomic<bool> go(false); // Start gate the workers spin on
+		atomic<long long> threadSink(0); // Accumulator the workers' lookups feed
+		vector<thread> workers; // The worker threads
+		for (int t = 0; t < threads; ++t) { // Spawn one worker per thread
+			workers.emplace_back([&, t] { // Each worker runs the shared operation loop
+				while (!go.load(memory_order_acquire)) { } // Spin until every worker is ready
+				long long localSink = 0; // Thread-local accumulator, flushed once at the end
+				scaleWorker(t, readPercent, // The shared workload against the sharded table
+					[&](int key) { localSink += table.contains(key) ? 1 : 0; }, // Lookup adapter
+					[&](int key, int value) { table.insert(key, value); }, // Insert adapter
+					[&](int key) { table.remove(key); }); // Remove adapter
+				threadSink.fetch_add(localSink, memory_order_relaxed); // Publish the accumulator
+            });
+        }
+		auto start = high_resolution_clock::now(); // Start the measured window
+		go.store(true, memory_order_release); // Release every worker at once
+		for (thread& w : workers) { // Wait for the workers
+			w.join(); // One at a time
+        }
+		auto end = high_resolution_clock::now(); // End the measured window
+		double seconds = duration_cast<nanoseconds>(end - start).count() / 1e9; // Wall time for all workers
+		if (threads == 1) { // The sweep's first step is the scaling baseline
+			baselineOpsPerSec = static_cast<double>(SCALE_OPS_PER_THREAD) / seconds; // One thread's aggregate throughput
+        }
+		reportScaleRow("ConcurrentHashTable", threads, readPercent, seconds, baselineOpsPerSec); // Report this thread count
+		sink += threadSink.load(memory_order_relaxed); // Fold the workers' accumulator into the global one
+    }
+	if (sink == 123456789) { // Impossible value, but the compiler cannot prove it
+		cerr << "sink" << endl; // Keeps the accumulators observable
+    }
+	return 0; // Return 0 to indicate successful completion
+}
 
+// Main function: with no arguments, runs the microbenchmark suite over both engines and a sweep
+// of element counts; with "trace <file>", replays a captured operation log instead; with
+// "scale [maxThreads] [readPercent]", sweeps thread counts on the sharded table.
+int main(int argc, char* argv[]) { // Main function
+	if (argc >= 2 && string(argv[1]) == "trace") { // Trace-replay mode requested
+		if (argc < 3) { // No trace file named
+			cerr << "Usage: " << argv[0] << " trace <file>" << endl; // Explain the mode's arguments
+			return 1; // Return 1 to indicate a usage error
+        }
+		try { // The trace file may be missing or malformed
+			return runTraceMode(argv[2]); // Replay the trace
+        }
+		catch (const exception& e) { // Loading or parsing failed
+			cerr << "Error: " << e.what() << endl; // Output error message
+			return 1; // Return 1 to indicate failure
+        }
+    }
+	if (argc >= 2 && string(argv[1]) == "scale") { // Scaling mode requested
+		int maxThreads = argc >= 3 ? stoi(argv[2]) : static_cast<int>(thread::hardware_concurrency()); // Thread counts to sweep, defaulting to the machine's cores
+		int readPercent = argc >= 4 ? stoi(argv[3]) : 90; // Read share of the mix, defaulting to the fleet's read-heavy profile
+		if (maxThreads < 1 || readPercent < 0 || readPercent > 100) { // Arguments outside their domains
+			cerr << "Usage: " << argv[0] << " scale [maxThreads] [readPercent]" << endl; // Explain the mode's arguments
+			return 1; // Return 1 to indicate a usage error
+        }
+		return runScaleMode(maxThreads, readPercent); // Sweep the thread counts
+    }
+	cout << "engine,elements,operation,repetitions,mean_ns_per_op,stddev_ns_per_op" << endl; // CSV header, printed once
+	for (int elements : { 1000, 10000, 100000 }) { // Sweep the element counts
+		benchmarkCustom<hash<int>>("HashTable", elements); // Benchmark the custom HashTable with the default hash
+		benchmarkCustom<IntegerMixHash>("HashTable+IntegerMixHash", elements); // And with the shipped mixing policy
+		benchmarkStd(elements); // Benchmark the standard baseline
+    }
 	return 0; // Return 0 to indicate successful completion
-}
\ No newline at end of file
+}